@@ -22,6 +22,7 @@
 #include "app_utils.h"
 
 #include <sup/epics/epics_protocol_factory.h>
+#include <sup/epics/pv_access_rpc_server.h>
 #include <sup/protocol/log_protocol_decorator.h>
 #include <sup/protocol/protocol_rpc_server.h>
 
@@ -80,7 +81,7 @@ int main(int argc, char* argv[])
   sup::protocol::ProtocolRPCServer protocol_server{protocol_decorator};
 
   auto service_name = parser.GetValue<std::string>("--service");
-  PvAccessRPCServerConfig server_config{service_name};
+  auto server_config = GetDefaultRPCServerConfig(service_name);
   auto rpc_logger = std::bind(utils::LogNetworkPacketsToStdOut, _1, _2,
                               utils::kServerInputPacketTitle, utils::kServerOutputPacketTitle);
   auto server = CreateLoggingEPICSRPCServer(server_config, protocol_server, rpc_logger);
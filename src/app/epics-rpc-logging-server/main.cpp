@@ -22,6 +22,7 @@
 #include "app_utils.h"
 
 #include <sup/epics/epics_protocol_factory.h>
+#include <sup/epics/pv_access_rpc_server.h>
 
 #include <sup/cli/command_line_parser.h>
 
@@ -63,7 +64,7 @@ int main(int argc, char* argv[])
   auto fixed_reply_functor = utils::GetFixedReplyFunctor(parser);
 
   auto service_name = parser.GetValue<std::string>("--service");
-  PvAccessRPCServerConfig server_config{service_name};
+  auto server_config = GetDefaultRPCServerConfig(service_name);
   auto logger = std::bind(utils::LogNetworkPacketsToStdOut, _1, _2, utils::kServerInputPacketTitle,
                          utils::kServerOutputPacketTitle);
   auto server = CreateLoggingEPICSRPCServer(server_config, *fixed_reply_functor, logger);
@@ -40,7 +40,9 @@ std::unique_ptr<PvAccessRPCClientConfig> PvAccessRPCClientConfigDefaultFactoryFu
 std::unique_ptr<PvAccessRPCClientConfig> PvAccessRPCClientConfigFactoryFunction(
   const std::string& service_name, double timeout)
 {
-  return std::make_unique<PvAccessRPCClientConfig>(PvAccessRPCClientConfig{service_name, timeout});
+  auto config = std::make_unique<PvAccessRPCClientConfig>(GetDefaultRPCClientConfig(service_name));
+  config->timeout = timeout;
+  return config;
 }
 
 const bool PvAccessRPCClientConfigDefault_Registered =
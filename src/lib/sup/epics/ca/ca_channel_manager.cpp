@@ -24,11 +24,15 @@
 #include <sup/epics/ca/ca_channel_tasks.h>
 #include <sup/epics/ca/ca_context_handle.h>
 #include <sup/epics/ca/ca_helper.h>
+#include <sup/epics/ca/ca_metrics.h>
 #include <sup/epics/ca/ca_monitor_wrapper.h>
 
 #include <sup/dto/anyvalue_helper.h>
 #include <cadef.h>
 #include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <tuple>
 #include <utility>
 
 namespace
@@ -42,19 +46,24 @@ std::vector<sup::dto::uint8> GetStringUpdateBuffer(const sup::dto::AnyValue& val
 std::vector<sup::dto::uint8> GetUnsignedEnumsUpdateBuffer(const sup::dto::AnyValue& value,
                                                           sup::dto::uint64 multiplicity);
 std::vector<sup::dto::uint8> GetUnsignedEnumUpdateBuffer(const sup::dto::AnyValue& value);
+std::vector<sup::dto::uint8> GetLongStringUpdateBuffer(const sup::dto::AnyValue& value,
+                                                       sup::dto::uint64 max_length);
 }  // unnamed namespace
 
 namespace sup
 {
 namespace epics
 {
+/**
+ * @brief ChannelInfo is constructed in place in the map's node and is never moved, since the
+ * Channel Access callbacks refer to its monitor wrapper.
+ */
 struct CAChannelManager::ChannelInfo
 {
-  ChannelInfo(const sup::dto::AnyType& anytype, ConnectionCallBack&& conn_cb,
-              MonitorCallBack&& mon_cb);
+  ChannelInfo(const sup::dto::AnyType& anytype, CAChannelListener* listener);
   sup::dto::AnyType channel_anytype;
   chid channel_id;
-  ConnectionCallBack connection_cb;
+  CAChannelCounters counters;
   CAMonitorWrapper monitor_cb;
 };
 
@@ -68,22 +77,23 @@ CAChannelManager::CAChannelManager()
 CAChannelManager::~CAChannelManager() = default;
 
 ChannelID CAChannelManager::AddChannel(const std::string& name, const sup::dto::AnyType& type,
-                                       ConnectionCallBack&& conn_cb, MonitorCallBack&& mon_cb)
+                                       CAChannelListener* listener, CAQoSClass qos_class)
 {
   auto channel_type = cahelper::ChannelType(type);
-  if (channel_type < 0)
+  if (channel_type < 0 || listener == nullptr)
   {
     return 0;
   }
   std::lock_guard<std::mutex> lk(mtx);
   EnsureContext();
   auto id = GenerateID();
-  auto [it, _] =
-      callback_map.emplace(id, ChannelInfo(type, std::move(conn_cb), std::move(mon_cb)));
+  auto [it, _] = callback_map.emplace(std::piecewise_construct, std::forward_as_tuple(id),
+                                      std::forward_as_tuple(type, listener));
   auto channel_info_it = &it->second;
-  auto add_task = std::packaged_task<bool()>([&name, channel_type, channel_info_it](){
-    return channeltasks::AddChannelTask(name, channel_type, &channel_info_it->channel_id,
-                                        &channel_info_it->connection_cb,
+  auto priority = CAPriority(qos_class);
+  auto add_task = std::packaged_task<bool()>([&name, channel_type, priority, channel_info_it](){
+    return channeltasks::AddChannelTask(name, channel_type, priority,
+                                        &channel_info_it->channel_id,
                                         &channel_info_it->monitor_cb);
   });
   if (!context_handle->HandleTask(std::move(add_task)))
@@ -128,18 +138,46 @@ bool CAChannelManager::UpdateChannel(ChannelID id, const sup::dto::AnyValue& val
   {
     return false;
   }
-  auto count = cahelper::ChannelMultiplicity(dest_type);
   auto channel_id = it->second.channel_id;
   auto byte_rep = GetUpdateBuffer(value, dest_type);
   if (byte_rep.size() == 0)
   {
     return false;
   }
+  // Long strings are only sent up to and including their terminating null character
+  auto count = IsLongStringType(dest_type) ? static_cast<sup::dto::uint64>(byte_rep.size())
+                                           : cahelper::ChannelMultiplicity(dest_type);
   auto ref = byte_rep.data();
   auto update_task = std::packaged_task<bool()>([type, count, channel_id, ref](){
     return channeltasks::UpdateChannelTask(type, count, channel_id, ref);
   });
-  return context_handle->HandleTask(std::move(update_task));
+  auto start = std::chrono::steady_clock::now();
+  auto result = context_handle->HandleTask(std::move(update_task));
+  auto latency = std::chrono::steady_clock::now() - start;
+  it->second.counters.RecordPut(static_cast<sup::dto::uint64>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count()));
+  return result;
+}
+
+CAChannelMetrics CAChannelManager::GetChannelMetrics(ChannelID id)
+{
+  std::lock_guard<std::mutex> lk(mtx);
+  auto it = callback_map.find(id);
+  if (it == callback_map.end())
+  {
+    return {};
+  }
+  return it->second.counters.GetMetrics();
+}
+
+CAContextMetrics CAChannelManager::GetContextMetrics()
+{
+  std::lock_guard<std::mutex> lk(mtx);
+  if (!context_handle)
+  {
+    return {};
+  }
+  return context_handle->GetMetrics();
 }
 
 ChannelID CAChannelManager::GenerateID()
@@ -172,12 +210,11 @@ CAChannelManager& SharedCAChannelManager()
 }
 
 CAChannelManager::ChannelInfo::ChannelInfo(const sup::dto::AnyType& anytype,
-                                           ConnectionCallBack&& conn_cb,
-                                           MonitorCallBack&& mon_cb)
+                                           CAChannelListener* listener)
   : channel_anytype{anytype}
   , channel_id{nullptr}
-  , connection_cb{std::move(conn_cb)}
-  , monitor_cb{anytype, std::move(mon_cb)}
+  , counters{}
+  , monitor_cb{anytype, listener, counters}
 {}
 
 }  // namespace epics
@@ -202,6 +239,10 @@ std::vector<sup::dto::uint8> GetUpdateBuffer(const sup::dto::AnyValue& value,
                                              const sup::dto::AnyType& dest_type)
 {
   using namespace sup::epics::cahelper;
+  if (sup::epics::IsLongStringType(dest_type))
+  {
+    return GetLongStringUpdateBuffer(value, dest_type.NumberOfElements());
+  }
   sup::dto::AnyValue dest_val{dest_type};
   if (!sup::dto::TryConvert(dest_val, value))
   {
@@ -284,4 +325,34 @@ std::vector<sup::dto::uint8> GetUnsignedEnumUpdateBuffer(const sup::dto::AnyValu
   return sup::dto::ToBytes(tmp);
 }
 
+std::vector<sup::dto::uint8> GetLongStringUpdateBuffer(const sup::dto::AnyValue& value,
+                                                       sup::dto::uint64 max_length)
+{
+  std::string str;
+  if (value.GetType() == sup::dto::StringType)
+  {
+    str = value.As<std::string>();
+  }
+  else if (sup::dto::IsArrayType(value.GetType())
+           && value.GetType().ElementType() == sup::dto::Character8Type)
+  {
+    // Character arrays, e.g. read from another long string channel, are copied up to the first
+    // null character
+    auto buffer = sup::dto::ToBytes(value);
+    auto end = std::find(buffer.begin(), buffer.end(), 0);
+    str.assign(buffer.begin(), end);
+  }
+  else
+  {
+    return {};
+  }
+  if (str.size() >= max_length)
+  {
+    return {};
+  }
+  std::vector<sup::dto::uint8> result(str.size() + 1, 0);
+  (void)std::memcpy(result.data(), str.data(), str.size());
+  return result;
+}
+
 }  // unnamed namespace
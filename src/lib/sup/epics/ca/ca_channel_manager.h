@@ -26,8 +26,8 @@
 #include <sup/dto/anytype.h>
 #include <sup/dto/anyvalue.h>
 
-#include <functional>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <list>
 #include <string>
@@ -49,12 +49,27 @@ public:
   CAChannelManager();
   ~CAChannelManager();
 
+  /**
+   * @brief Add a channel and subscribe to its value.
+   *
+   * @param name EPICS channel name.
+   * @param type Type to use for the channel.
+   * @param listener Listener for connection and monitor events. It has to outlive the channel.
+   * @param qos_class Quality of service class that determines the channel's priority.
+   *
+   * @return Non-zero channel identifier on success, zero otherwise.
+   */
   ChannelID AddChannel(const std::string& name, const sup::dto::AnyType& type,
-                       ConnectionCallBack&& conn_cb, MonitorCallBack&& mon_cb);
+                       CAChannelListener* listener,
+                       CAQoSClass qos_class = CAQoSClass::kDefault);
 
   bool RemoveChannel(ChannelID id);
 
   bool UpdateChannel(ChannelID id, const sup::dto::AnyValue& value);
+
+  CAChannelMetrics GetChannelMetrics(ChannelID id);
+
+  CAContextMetrics GetContextMetrics();
 private:
   ChannelID GenerateID();
   void EnsureContext();
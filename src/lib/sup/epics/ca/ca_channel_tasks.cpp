@@ -36,21 +36,24 @@ namespace epics
 namespace channeltasks
 {
 
-bool AddChannelTask(const std::string& name, chtype type, chid* id,
-                    ConnectionCallBack* connect_cb, CAMonitorWrapper* monitor_cb)
+bool AddChannelTask(const std::string& name, chtype type, sup::dto::uint32 priority, chid* id,
+                    CAMonitorWrapper* channel_wrapper)
 {
-  if (ca_create_channel(name.c_str(), &Connection_CB, connect_cb, 10, id) != ECA_NORMAL)
+  if (channel_wrapper == nullptr)
   {
     return false;
   }
-  if (monitor_cb != nullptr)
+  if (ca_create_channel(name.c_str(), &Connection_CB, channel_wrapper,
+                        static_cast<capri>(priority), id)
+      != ECA_NORMAL)
   {
-    if (ca_create_subscription(type + 14, 0, *id, DBE_VALUE | DBE_ALARM, &Monitor_CB, monitor_cb,
-                               nullptr)
-        != ECA_NORMAL)
-    {
-      return false;
-    }
+    return false;
+  }
+  if (ca_create_subscription(type + 14, 0, *id, DBE_VALUE | DBE_ALARM, &Monitor_CB,
+                             channel_wrapper, nullptr)
+      != ECA_NORMAL)
+  {
+    return false;
   }
   (void)ca_flush_io();
   return true;
@@ -87,20 +90,21 @@ namespace
 void Monitor_CB(event_handler_args args)
 {
   using namespace sup::epics::cahelper;
+  auto receive_time = GetSystemTime_ns();
   auto timestamp = GetTimestampField(args);
   auto status = GetStatusField(args);
   auto severity = GetSeverityField(args);
   auto ref = GetValueFieldReference(args);
   auto count = args.count;
   auto func = static_cast<sup::epics::CAMonitorWrapper*>(args.usr);
-  return (*func)(timestamp, status, severity, count, ref);
+  return (*func)(timestamp, status, severity, count, ref, receive_time);
 }
 
 void Connection_CB(connection_handler_args args)
 {
   bool connected = (args.op == CA_OP_CONN_UP);
-  auto func = static_cast<sup::epics::ConnectionCallBack*>(ca_puser(args.chid));
-  return (*func)(connected);
+  auto wrapper = static_cast<sup::epics::CAMonitorWrapper*>(ca_puser(args.chid));
+  wrapper->OnConnectionChanged(connected);
 }
 
 }  // unnamed namespace
@@ -33,8 +33,8 @@ namespace epics
 namespace channeltasks
 {
 
-bool AddChannelTask(const std::string& name, chtype type, chid* id,
-                    ConnectionCallBack* connect_cb, CAMonitorWrapper* monitor_cb);
+bool AddChannelTask(const std::string& name, chtype type, sup::dto::uint32 priority, chid* id,
+                    CAMonitorWrapper* channel_wrapper);
 
 bool RemoveChannelTask(chid id);
 
@@ -29,7 +29,8 @@ namespace epics
 {
 
 CAContextHandle::CAContextHandle()
-  : tasks{}
+  : counters{}
+  , tasks{}
   , task_mtx{}
   , cond{}
   , halt{false}
@@ -58,12 +59,18 @@ bool CAContextHandle::HandleTask(std::packaged_task<bool()>&& task)
   auto result = task.get_future();
   {
     std::lock_guard<std::mutex> lk(task_mtx);
-    tasks.push(std::move(task));
+    tasks.push({std::move(task), std::chrono::steady_clock::now()});
+    counters.RecordQueueDepth(tasks.size());
   }
   cond.notify_one();
   return result.get();
 }
 
+CAContextMetrics CAContextHandle::GetMetrics() const
+{
+  return counters.GetMetrics();
+}
+
 bool CAContextHandle::LaunchContext()
 {
   std::promise<bool> context_promise;
@@ -107,14 +114,18 @@ void CAContextHandle::ContextThread(std::promise<bool>& context_promise)
   while(!halt_cache)
   {
     cond.wait(lk, [this](){ return halt || !tasks.empty(); });
-    std::queue<std::packaged_task<bool()>> task_queue;
+    std::queue<QueuedTask> task_queue;
     tasks.swap(task_queue);
+    counters.RecordQueueDepth(0);
     halt_cache = halt;
     lk.unlock();
     while (!task_queue.empty())
     {
-      auto& task = task_queue.front();
-      task();
+      auto& queued_task = task_queue.front();
+      auto wait_time = std::chrono::steady_clock::now() - queued_task.queued_time;
+      counters.RecordTaskStart(static_cast<sup::dto::uint64>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(wait_time).count()));
+      queued_task.task();
       task_queue.pop();
     }
     lk.lock();
@@ -21,6 +21,9 @@
 #ifndef SUP_EPICS_CA_CONTEXT_HANDLE_H_
 #define SUP_EPICS_CA_CONTEXT_HANDLE_H_
 
+#include <sup/epics/ca/ca_metrics.h>
+
+#include <chrono>
 #include <condition_variable>
 #include <future>
 #include <mutex>
@@ -45,11 +48,19 @@ public:
 
   bool HandleTask(std::packaged_task<bool()>&& task);
 
+  CAContextMetrics GetMetrics() const;
+
 private:
+  struct QueuedTask
+  {
+    std::packaged_task<bool()> task;
+    std::chrono::steady_clock::time_point queued_time;
+  };
   bool LaunchContext();
   void HaltContext();
   void ContextThread(std::promise<bool>& context_promise);
-  std::queue<std::packaged_task<bool()>> tasks;
+  CAContextCounters counters;
+  std::queue<QueuedTask> tasks;
   std::mutex task_mtx;
   std::condition_variable cond;
   bool halt;
@@ -20,6 +20,8 @@
 
 #include <sup/epics/ca/ca_helper.h>
 
+#include <sup/epics/ca_types.h>
+
 #include <sup/dto/anytype.h>
 #include <sup/dto/anyvalue_helper.h>
 #include <sup/dto/anyvalue_exceptions.h>
@@ -27,6 +29,8 @@
 
 #include <cadef.h>
 
+#include <chrono>
+#include <cstring>
 #include <map>
 #include <vector>
 
@@ -47,6 +51,7 @@ sup::dto::AnyValue ParseBooleans(const sup::dto::AnyType& anytype, char* ref,
 sup::dto::AnyValue ParseBoolean(char* ref);
 sup::dto::AnyValue ParseFromBytes(const sup::dto::AnyType& anytype, chtype channeltype, char* ref,
                                   sup::dto::uint64 multiplicity);
+sup::dto::AnyValue ParseLongString(const char* ref, sup::dto::uint64 count);
 std::string GetEPICSString(char* ref);
 
 }  // unnamed namespace
@@ -97,6 +102,13 @@ sup::dto::uint64 GetTimestampField(event_handler_args args)
   return ToAbsoluteTime_ns(_time->secPastEpoch + POSIX_TIME_AT_EPICS_EPOCH, _time->nsec);
 }
 
+sup::dto::uint64 GetSystemTime_ns()
+{
+  auto now = std::chrono::system_clock::now();
+  return static_cast<sup::dto::uint64>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count());
+}
+
 chtype ChannelType(const sup::dto::AnyType& anytype)
 {
   return sup::dto::IsArrayType(anytype) ?
@@ -116,6 +128,10 @@ sup::dto::AnyValue ParseAnyValue(const sup::dto::AnyType& anytype, sup::dto::uin
   {
     return {};
   }
+  if (IsLongStringType(anytype))
+  {
+    return ParseLongString(ref, count);
+  }
   auto chtype = ChannelType(anytype);
   if (chtype == DBR_STRING)
   {
@@ -320,6 +336,11 @@ sup::dto::AnyValue ParseFromBytes(const sup::dto::AnyType& anytype, chtype chann
   return temp;
 }
 
+sup::dto::AnyValue ParseLongString(const char* ref, sup::dto::uint64 count)
+{
+  return std::string(ref, strnlen(ref, count));
+}
+
 std::string GetEPICSString(char* ref)
 {
   const std::size_t kEpicsStringLength = dbr_size[DBR_STRING];
@@ -40,6 +40,8 @@ sup::dto::int16 GetSeverityField(event_handler_args args);
 
 sup::dto::uint64 GetTimestampField(event_handler_args args);
 
+sup::dto::uint64 GetSystemTime_ns();
+
 chtype ChannelType(const sup::dto::AnyType& anytype);
 
 sup::dto::uint64 ChannelMultiplicity(const sup::dto::AnyType& anytype);
@@ -0,0 +1,174 @@
+/******************************************************************************
+ *
+ * Project       : Supervision and automation system EPICS interface
+ *
+ * Description   : Library of SUP components for EPICS network protocol
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include <sup/epics/ca_latency_histogram.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+// Values below kLinearLimit are counted exactly
+const sup::dto::uint64 kSubBucketBits = 4;
+const sup::dto::uint64 kSubBucketCount = 1u << kSubBucketBits;
+const sup::dto::uint64 kLinearLimit = 2 * kSubBucketCount;
+const sup::dto::uint64 kMaxMagnitude = 40;
+// One extra bucket for values with a magnitude of kMaxMagnitude or higher
+const std::size_t kNumberOfBuckets =
+  kLinearLimit + (kMaxMagnitude - kSubBucketBits - 1) * kSubBucketCount + 1;
+
+std::size_t BucketIndex(sup::dto::uint64 value);
+sup::dto::uint64 BucketUpperBound(std::size_t index);
+}  // unnamed namespace
+
+namespace sup
+{
+namespace epics
+{
+
+CALatencyHistogram::CALatencyHistogram()
+  : m_counts(kNumberOfBuckets, 0)
+  , m_total_count{0}
+  , m_min{std::numeric_limits<sup::dto::uint64>::max()}
+  , m_max{0}
+  , m_sum{0.0}
+{}
+
+CALatencyHistogram::~CALatencyHistogram() = default;
+
+CALatencyHistogram::CALatencyHistogram(const CALatencyHistogram& other) = default;
+
+CALatencyHistogram::CALatencyHistogram(CALatencyHistogram&& other) = default;
+
+CALatencyHistogram& CALatencyHistogram::operator=(const CALatencyHistogram& other) = default;
+
+CALatencyHistogram& CALatencyHistogram::operator=(CALatencyHistogram&& other) = default;
+
+void CALatencyHistogram::Record(sup::dto::uint64 value_ns)
+{
+  ++m_counts[BucketIndex(value_ns)];
+  ++m_total_count;
+  m_min = std::min(m_min, value_ns);
+  m_max = std::max(m_max, value_ns);
+  m_sum += static_cast<double>(value_ns);
+}
+
+void CALatencyHistogram::Reset()
+{
+  std::fill(m_counts.begin(), m_counts.end(), 0);
+  m_total_count = 0;
+  m_min = std::numeric_limits<sup::dto::uint64>::max();
+  m_max = 0;
+  m_sum = 0.0;
+}
+
+sup::dto::uint64 CALatencyHistogram::GetCount() const
+{
+  return m_total_count;
+}
+
+sup::dto::uint64 CALatencyHistogram::GetMin() const
+{
+  return m_total_count == 0 ? 0 : m_min;
+}
+
+sup::dto::uint64 CALatencyHistogram::GetMax() const
+{
+  return m_max;
+}
+
+double CALatencyHistogram::GetMean() const
+{
+  return m_total_count == 0 ? 0.0 : m_sum / static_cast<double>(m_total_count);
+}
+
+sup::dto::uint64 CALatencyHistogram::GetValueAtPercentile(double percentile) const
+{
+  if (m_total_count == 0)
+  {
+    return 0;
+  }
+  auto clamped = std::min(std::max(percentile, 0.0), 100.0);
+  auto target = static_cast<sup::dto::uint64>(
+    std::ceil(clamped / 100.0 * static_cast<double>(m_total_count)));
+  target = std::max<sup::dto::uint64>(target, 1);
+  sup::dto::uint64 accumulated = 0;
+  for (std::size_t idx = 0; idx < m_counts.size(); ++idx)
+  {
+    accumulated += m_counts[idx];
+    if (accumulated >= target)
+    {
+      return std::max(std::min(BucketUpperBound(idx), m_max), GetMin());
+    }
+  }
+  return m_max;
+}
+
+}  // namespace epics
+
+}  // namespace sup
+
+namespace
+{
+std::size_t MostSignificantBit(sup::dto::uint64 value)
+{
+  std::size_t result = 0;
+  while (value >>= 1)
+  {
+    ++result;
+  }
+  return result;
+}
+
+std::size_t BucketIndex(sup::dto::uint64 value)
+{
+  if (value < kLinearLimit)
+  {
+    return static_cast<std::size_t>(value);
+  }
+  auto magnitude = MostSignificantBit(value);
+  if (magnitude >= kMaxMagnitude)
+  {
+    return kNumberOfBuckets - 1;
+  }
+  auto shift = magnitude - kSubBucketBits;
+  auto sub_bucket = (value >> shift) - kSubBucketCount;
+  return kLinearLimit + (magnitude - kSubBucketBits - 1) * kSubBucketCount + sub_bucket;
+}
+
+sup::dto::uint64 BucketUpperBound(std::size_t index)
+{
+  if (index < kLinearLimit)
+  {
+    return index;
+  }
+  if (index == kNumberOfBuckets - 1)
+  {
+    return std::numeric_limits<sup::dto::uint64>::max();
+  }
+  auto offset = index - kLinearLimit;
+  auto magnitude = offset / kSubBucketCount + kSubBucketBits + 1;
+  auto sub_bucket = offset % kSubBucketCount + kSubBucketCount;
+  auto shift = magnitude - kSubBucketBits;
+  return ((sub_bucket + 1) << shift) - 1;
+}
+
+}  // unnamed namespace
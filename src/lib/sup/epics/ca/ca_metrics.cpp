@@ -0,0 +1,173 @@
+/******************************************************************************
+ *
+ * Project       : Supervision and automation system EPICS interface
+ *
+ * Description   : Library of SUP components for EPICS network protocol
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include <sup/epics/ca/ca_metrics.h>
+
+namespace
+{
+void UpdateMaximum(std::atomic<sup::dto::uint64>& maximum, sup::dto::uint64 value);
+}  // unnamed namespace
+
+namespace sup
+{
+namespace epics
+{
+
+CAChannelCounters::CAChannelCounters()
+  : m_monitors_received{0}
+  , m_bytes_decoded{0}
+  , m_decode_failures{0}
+  , m_connections{0}
+  , m_disconnections{0}
+  , m_puts{0}
+  , m_put_latency_total_ns{0}
+  , m_put_latency_max_ns{0}
+  , m_decode_time_histogram{}
+{
+  for (auto& bin : m_decode_time_histogram)
+  {
+    bin.store(0, std::memory_order_relaxed);
+  }
+}
+
+CAChannelCounters::~CAChannelCounters() = default;
+
+void CAChannelCounters::RecordMonitor(sup::dto::uint64 bytes, sup::dto::uint64 decode_ns,
+                                      bool success)
+{
+  (void)m_monitors_received.fetch_add(1, std::memory_order_relaxed);
+  if (!success)
+  {
+    (void)m_decode_failures.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  (void)m_bytes_decoded.fetch_add(bytes, std::memory_order_relaxed);
+  auto bin = cametrics::DecodeHistogramBin(decode_ns);
+  (void)m_decode_time_histogram[bin].fetch_add(1, std::memory_order_relaxed);
+}
+
+void CAChannelCounters::RecordMonitorWithoutValue()
+{
+  (void)m_monitors_received.fetch_add(1, std::memory_order_relaxed);
+}
+
+void CAChannelCounters::RecordConnection(bool connected)
+{
+  if (connected)
+  {
+    (void)m_connections.fetch_add(1, std::memory_order_relaxed);
+  }
+  else
+  {
+    (void)m_disconnections.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void CAChannelCounters::RecordPut(sup::dto::uint64 latency_ns)
+{
+  (void)m_puts.fetch_add(1, std::memory_order_relaxed);
+  (void)m_put_latency_total_ns.fetch_add(latency_ns, std::memory_order_relaxed);
+  UpdateMaximum(m_put_latency_max_ns, latency_ns);
+}
+
+CAChannelMetrics CAChannelCounters::GetMetrics() const
+{
+  CAChannelMetrics result{};
+  result.monitors_received = m_monitors_received.load(std::memory_order_relaxed);
+  result.bytes_decoded = m_bytes_decoded.load(std::memory_order_relaxed);
+  result.decode_failures = m_decode_failures.load(std::memory_order_relaxed);
+  result.connections = m_connections.load(std::memory_order_relaxed);
+  result.disconnections = m_disconnections.load(std::memory_order_relaxed);
+  result.puts = m_puts.load(std::memory_order_relaxed);
+  result.put_latency_total_ns = m_put_latency_total_ns.load(std::memory_order_relaxed);
+  result.put_latency_max_ns = m_put_latency_max_ns.load(std::memory_order_relaxed);
+  for (std::size_t idx = 0; idx < kCADecodeHistogramBins; ++idx)
+  {
+    result.decode_time_histogram[idx] =
+      m_decode_time_histogram[idx].load(std::memory_order_relaxed);
+  }
+  return result;
+}
+
+CAContextCounters::CAContextCounters()
+  : m_tasks_handled{0}
+  , m_queue_depth{0}
+  , m_max_queue_depth{0}
+  , m_task_wait_total_ns{0}
+  , m_task_wait_max_ns{0}
+{}
+
+CAContextCounters::~CAContextCounters() = default;
+
+void CAContextCounters::RecordQueueDepth(sup::dto::uint64 depth)
+{
+  m_queue_depth.store(depth, std::memory_order_relaxed);
+  UpdateMaximum(m_max_queue_depth, depth);
+}
+
+void CAContextCounters::RecordTaskStart(sup::dto::uint64 wait_ns)
+{
+  (void)m_tasks_handled.fetch_add(1, std::memory_order_relaxed);
+  (void)m_task_wait_total_ns.fetch_add(wait_ns, std::memory_order_relaxed);
+  UpdateMaximum(m_task_wait_max_ns, wait_ns);
+}
+
+CAContextMetrics CAContextCounters::GetMetrics() const
+{
+  CAContextMetrics result{};
+  result.tasks_handled = m_tasks_handled.load(std::memory_order_relaxed);
+  result.queue_depth = m_queue_depth.load(std::memory_order_relaxed);
+  result.max_queue_depth = m_max_queue_depth.load(std::memory_order_relaxed);
+  result.task_wait_total_ns = m_task_wait_total_ns.load(std::memory_order_relaxed);
+  result.task_wait_max_ns = m_task_wait_max_ns.load(std::memory_order_relaxed);
+  return result;
+}
+
+namespace cametrics
+{
+std::size_t DecodeHistogramBin(sup::dto::uint64 duration_ns)
+{
+  auto duration_us = duration_ns / 1000u;
+  std::size_t bin = 0;
+  while (duration_us > 0 && bin + 1 < kCADecodeHistogramBins)
+  {
+    duration_us >>= 1;
+    ++bin;
+  }
+  return bin;
+}
+
+}  // namespace cametrics
+
+}  // namespace epics
+
+}  // namespace sup
+
+namespace
+{
+void UpdateMaximum(std::atomic<sup::dto::uint64>& maximum, sup::dto::uint64 value)
+{
+  auto current = maximum.load(std::memory_order_relaxed);
+  while (current < value
+         && !maximum.compare_exchange_weak(current, value, std::memory_order_relaxed))
+  {}
+}
+
+}  // unnamed namespace
@@ -0,0 +1,106 @@
+/******************************************************************************
+ *
+ * Project       : Supervision and automation system EPICS interface
+ *
+ * Description   : Library of SUP components for EPICS network protocol
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_EPICS_CA_METRICS_H_
+#define SUP_EPICS_CA_METRICS_H_
+
+#include <sup/epics/ca_types.h>
+
+#include <atomic>
+
+namespace sup
+{
+namespace epics
+{
+/**
+ * @brief CAChannelCounters accumulates the metrics of a single channel.
+ *
+ * @note All updates are relaxed atomic increments, so the counters can stay enabled in
+ * production. Monitor and connection callbacks of a single channel are serialized by the CA
+ * library, so the counters are effectively written by a single thread at a time and the
+ * different fields are only aggregated into a consistent snapshot when reading them.
+ */
+class CAChannelCounters
+{
+public:
+  CAChannelCounters();
+  ~CAChannelCounters();
+
+  CAChannelCounters(const CAChannelCounters& other) = delete;
+  CAChannelCounters& operator=(const CAChannelCounters& other) = delete;
+
+  void RecordMonitor(sup::dto::uint64 bytes, sup::dto::uint64 decode_ns, bool success);
+  void RecordMonitorWithoutValue();
+  void RecordConnection(bool connected);
+  void RecordPut(sup::dto::uint64 latency_ns);
+
+  CAChannelMetrics GetMetrics() const;
+
+private:
+  std::atomic<sup::dto::uint64> m_monitors_received;
+  std::atomic<sup::dto::uint64> m_bytes_decoded;
+  std::atomic<sup::dto::uint64> m_decode_failures;
+  std::atomic<sup::dto::uint64> m_connections;
+  std::atomic<sup::dto::uint64> m_disconnections;
+  std::atomic<sup::dto::uint64> m_puts;
+  std::atomic<sup::dto::uint64> m_put_latency_total_ns;
+  std::atomic<sup::dto::uint64> m_put_latency_max_ns;
+  std::array<std::atomic<sup::dto::uint64>, kCADecodeHistogramBins> m_decode_time_histogram;
+};
+
+/**
+ * @brief CAContextCounters accumulates the metrics of the task queue of a CAContextHandle.
+ */
+class CAContextCounters
+{
+public:
+  CAContextCounters();
+  ~CAContextCounters();
+
+  CAContextCounters(const CAContextCounters& other) = delete;
+  CAContextCounters& operator=(const CAContextCounters& other) = delete;
+
+  void RecordQueueDepth(sup::dto::uint64 depth);
+  void RecordTaskStart(sup::dto::uint64 wait_ns);
+
+  CAContextMetrics GetMetrics() const;
+
+private:
+  std::atomic<sup::dto::uint64> m_tasks_handled;
+  std::atomic<sup::dto::uint64> m_queue_depth;
+  std::atomic<sup::dto::uint64> m_max_queue_depth;
+  std::atomic<sup::dto::uint64> m_task_wait_total_ns;
+  std::atomic<sup::dto::uint64> m_task_wait_max_ns;
+};
+
+namespace cametrics
+{
+/**
+ * @brief Index of the decode time histogram bin for the given duration in nanoseconds.
+ */
+std::size_t DecodeHistogramBin(sup::dto::uint64 duration_ns);
+
+}  // namespace cametrics
+
+}  // namespace epics
+
+}  // namespace sup
+
+#endif  // SUP_EPICS_CA_METRICS_H_
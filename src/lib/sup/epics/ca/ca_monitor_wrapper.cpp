@@ -23,30 +23,64 @@
 #include <sup/epics/ca/ca_helper.h>
 
 #include <sup/dto/anyvalue_helper.h>
+#include <chrono>
 #include <string.h>
 
 namespace sup
 {
 namespace epics
 {
-CAMonitorWrapper::CAMonitorWrapper(sup::dto::AnyType anytype, MonitorCallBack&& mon_cb)
+CAMonitorWrapper::CAMonitorWrapper(sup::dto::AnyType anytype, CAChannelListener* listener,
+                                   CAChannelCounters& counters)
   : m_anytype{std::move(anytype)}
-  , m_mon_cb{std::move(mon_cb)}
-{}
+  , m_element_size{0}
+  , m_listener{listener}
+  , m_counters{counters}
+{
+  auto channel_type = cahelper::ChannelType(m_anytype);
+  if (channel_type >= 0)
+  {
+    m_element_size = dbr_size[channel_type];
+  }
+}
+
+void CAMonitorWrapper::OnConnectionChanged(bool connected)
+{
+  m_counters.RecordConnection(connected);
+  m_listener->OnConnectionChanged(connected);
+}
 
 void CAMonitorWrapper::operator()(sup::dto::uint64 timestamp, sup::dto::int16 status,
-                                  sup::dto::int16 severity, sup::dto::int64 count, void* ref)
+                                  sup::dto::int16 severity, sup::dto::int64 count, void* ref,
+                                  sup::dto::uint64 receive_time)
 {
   CAMonitorInfo info;
   info.timestamp = timestamp;
   info.status = status;
   info.severity = severity;
+  info.receive_time = receive_time;
   if (ref && VerifyCount(count))  // Only dereference ref during success
   {
+    auto start = std::chrono::steady_clock::now();
     info.value = cahelper::ParseAnyValue(m_anytype, static_cast<dto::uint64>(count),
                                          static_cast<char*>(ref));
+    auto decode_time = std::chrono::steady_clock::now() - start;
+    m_counters.RecordMonitor(
+      m_element_size * static_cast<dto::uint64>(count),
+      static_cast<dto::uint64>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(decode_time).count()),
+      !sup::dto::IsEmptyValue(info.value));
+  }
+  else if (ref)
+  {
+    m_counters.RecordMonitor(0, 0, false);
+  }
+  else
+  {
+    m_counters.RecordMonitorWithoutValue();
   }
-  return m_mon_cb(info);
+  info.decode_time = cahelper::GetSystemTime_ns();
+  m_listener->OnMonitorCalled(info);
 }
 
 bool CAMonitorWrapper::VerifyCount(sup::dto::int64 count)
@@ -22,22 +22,35 @@
 #define SUP_EPICS_CA_MONITOR_WRAPPER_H_
 
 #include <sup/epics/ca/ca_channel_manager.h>
+#include <sup/epics/ca/ca_metrics.h>
 #include <sup/dto/anytype.h>
 
 namespace sup
 {
 namespace epics
 {
+/**
+ * @brief CAMonitorWrapper decodes the raw Channel Access events of a single channel and forwards
+ * them to its listener.
+ *
+ * @note The wrapper is used as user data of both the connection and the monitor callbacks of the
+ * channel, so it needs a stable address for the lifetime of the channel.
+ */
 class CAMonitorWrapper
 {
 public:
-  CAMonitorWrapper(sup::dto::AnyType anytype, MonitorCallBack&& mon_cb);
+  CAMonitorWrapper(sup::dto::AnyType anytype, CAChannelListener* listener,
+                   CAChannelCounters& counters);
+  void OnConnectionChanged(bool connected);
   void operator()(sup::dto::uint64 timestamp, sup::dto::int16 status,
-                  sup::dto::int16 severity, sup::dto::int64 count, void* ref);
+                  sup::dto::int16 severity, sup::dto::int64 count, void* ref,
+                  sup::dto::uint64 receive_time);
 private:
   bool VerifyCount(sup::dto::int64 count);
   sup::dto::AnyType m_anytype;
-  MonitorCallBack m_mon_cb;
+  sup::dto::uint64 m_element_size;
+  CAChannelListener* m_listener;
+  CAChannelCounters& m_counters;
 };
 
 }  // namespace epics
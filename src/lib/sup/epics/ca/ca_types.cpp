@@ -0,0 +1,78 @@
+/******************************************************************************
+ *
+ * Project       : Supervision and automation system EPICS interface
+ *
+ * Description   : Library of SUP components for EPICS network protocol
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include <sup/epics/ca_types.h>
+
+namespace
+{
+const sup::dto::uint32 kBulkPriority = 0;
+const sup::dto::uint32 kDefaultPriority = 10;
+const sup::dto::uint32 kCriticalPriority = 99;
+}  // unnamed namespace
+
+namespace sup
+{
+namespace epics
+{
+
+sup::dto::AnyType LongStringType(sup::dto::uint64 max_length)
+{
+  return sup::dto::AnyType{max_length, sup::dto::Character8Type, kLongStringTypeName};
+}
+
+bool IsLongStringType(const sup::dto::AnyType& anytype)
+{
+  return sup::dto::IsArrayType(anytype) && anytype.GetTypeName() == kLongStringTypeName
+         && anytype.ElementType() == sup::dto::Character8Type;
+}
+
+sup::dto::uint32 CAPriority(CAQoSClass qos_class)
+{
+  if (qos_class == CAQoSClass::kBulk)
+  {
+    return kBulkPriority;
+  }
+  if (qos_class == CAQoSClass::kCritical)
+  {
+    return kCriticalPriority;
+  }
+  return kDefaultPriority;
+}
+
+std::pair<bool, CAQoSClass> ParseCAQoSClass(const std::string& name)
+{
+  if (name == kCAQoSBulk)
+  {
+    return { true, CAQoSClass::kBulk };
+  }
+  if (name == kCAQoSDefault)
+  {
+    return { true, CAQoSClass::kDefault };
+  }
+  if (name == kCAQoSCritical)
+  {
+    return { true, CAQoSClass::kCritical };
+  }
+  return { false, CAQoSClass::kDefault };
+}
+
+}  // namespace epics
+
+}  // namespace sup
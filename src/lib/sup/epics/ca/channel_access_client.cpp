@@ -20,6 +20,8 @@
 
 #include <sup/epics/channel_access_client.h>
 
+#include <sup/epics/ca/ca_channel_manager.h>
+
 #include <stdexcept>
 
 namespace sup
@@ -34,18 +36,24 @@ ChannelAccessClient::ChannelAccessClient(VariableUpdatedCallback cb)
 
 ChannelAccessClient::~ChannelAccessClient() = default;
 
-bool ChannelAccessClient::AddVariable(const std::string& channel, const sup::dto::AnyType& type)
+bool ChannelAccessClient::AddVariable(const std::string& channel, const sup::dto::AnyType& type,
+                                      CAQoSClass qos_class)
 {
   if (pv_map.find(channel) != pv_map.end())
   {
     return false;
   }
+  // Only install a per-variable callback when there is a client callback to forward to
+  ChannelAccessPV::VariableChangedCallback pv_cb;
+  if (var_updated_cb)
+  {
+    pv_cb = [this, channel](const ChannelAccessPV::ExtendedValue& value)
+            { OnVariableUpdated(channel, value); };
+  }
   std::unique_ptr<ChannelAccessPV> pv;
   try
   {
-    pv = std::make_unique<ChannelAccessPV>(
-        channel, type, [this, channel](auto&& PH1)
-        { OnVariableUpdated(channel, std::forward<decltype(PH1)>(PH1)); });
+    pv = std::make_unique<ChannelAccessPV>(channel, type, std::move(pv_cb), qos_class);
   }
   catch (const std::runtime_error&)
   {
@@ -138,6 +146,42 @@ bool ChannelAccessClient::RemoveVariable(const std::string& channel)
   return true;
 }
 
+CAChannelMetrics ChannelAccessClient::GetMetrics(const std::string& channel) const
+{
+  auto it = pv_map.find(channel);
+  if (it == pv_map.end())
+  {
+    return {};
+  }
+  return it->second->GetMetrics();
+}
+
+CAContextMetrics ChannelAccessClient::GetContextMetrics() const
+{
+  return SharedCAChannelManager().GetContextMetrics();
+}
+
+bool ChannelAccessClient::EnableLatencyTracing(const std::string& channel, bool enable)
+{
+  auto it = pv_map.find(channel);
+  if (it == pv_map.end())
+  {
+    return false;
+  }
+  it->second->EnableLatencyTracing(enable);
+  return true;
+}
+
+CALatencyMetrics ChannelAccessClient::GetLatencyMetrics(const std::string& channel) const
+{
+  auto it = pv_map.find(channel);
+  if (it == pv_map.end())
+  {
+    return CALatencyMetrics{};
+  }
+  return it->second->GetLatencyMetrics();
+}
+
 void ChannelAccessClient::OnVariableUpdated(const std::string& channel,
                                             const ChannelAccessPV::ExtendedValue& value)
 {
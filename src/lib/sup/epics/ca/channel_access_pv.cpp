@@ -21,6 +21,7 @@
 #include <sup/epics/channel_access_pv.h>
 
 #include <sup/epics/ca/ca_channel_manager.h>
+#include <sup/epics/ca/ca_helper.h>
 
 #include <chrono>
 #include <cmath>
@@ -39,17 +40,18 @@ ChannelAccessPV::ExtendedValue::ExtendedValue()
 {}
 
 ChannelAccessPV::ChannelAccessPV(
-  const std::string& channel, const sup::dto::AnyType& type, VariableChangedCallback cb)
+  const std::string& channel, const sup::dto::AnyType& type, VariableChangedCallback cb,
+  CAQoSClass qos_class)
   : m_channel_name{channel}
+  , m_qos_class{qos_class}
   , m_cache{}
   , m_id{0}
   , m_mon_mtx{}
   , m_monitor_cv{}
   , m_var_changed_cb{std::move(cb)}
+  , m_latency_metrics{}
 {
-  m_id = SharedCAChannelManager().AddChannel(channel, type,
-    std::bind(&ChannelAccessPV::OnConnectionChanged, this, std::placeholders::_1),
-    std::bind(&ChannelAccessPV::OnMonitorCalled, this, std::placeholders::_1));
+  m_id = SharedCAChannelManager().AddChannel(channel, type, this, m_qos_class);
   if (m_id == 0)
   {
     throw std::runtime_error("Could not construct ChannelAccessPV");
@@ -75,6 +77,11 @@ std::string ChannelAccessPV::GetChannelName() const
   return m_channel_name;
 }
 
+CAQoSClass ChannelAccessPV::GetQoSClass() const
+{
+  return m_qos_class;
+}
+
 sup::dto::AnyValue ChannelAccessPV::GetValue() const
 {
   std::lock_guard<std::mutex> lk(m_mon_mtx);
@@ -106,6 +113,34 @@ bool ChannelAccessPV::WaitForConnected(double timeout_sec) const
   return m_monitor_cv.wait_for(lk, duration, pred);
 }
 
+CAChannelMetrics ChannelAccessPV::GetMetrics() const
+{
+  return SharedCAChannelManager().GetChannelMetrics(m_id);
+}
+
+void ChannelAccessPV::EnableLatencyTracing(bool enable)
+{
+  std::lock_guard<std::mutex> lk(m_mon_mtx);
+  if (enable)
+  {
+    m_latency_metrics = std::make_unique<CALatencyMetrics>();
+  }
+  else
+  {
+    m_latency_metrics.reset();
+  }
+}
+
+CALatencyMetrics ChannelAccessPV::GetLatencyMetrics() const
+{
+  std::lock_guard<std::mutex> lk(m_mon_mtx);
+  if (!m_latency_metrics)
+  {
+    return CALatencyMetrics{};
+  }
+  return *m_latency_metrics;
+}
+
 bool ChannelAccessPV::WaitForValidValue(double timeout_sec) const
 {
   auto duration = std::chrono::duration<double>(timeout_sec);
@@ -141,10 +176,36 @@ void ChannelAccessPV::OnMonitorCalled(const CAMonitorInfo& info)
     {
       m_var_changed_cb(m_cache);
     }
+    if (m_latency_metrics)
+    {
+      RecordLatencies(info);
+    }
   }
   m_monitor_cv.notify_one();
 }
 
+void ChannelAccessPV::RecordLatencies(const CAMonitorInfo& info)
+{
+  auto delivery_time = cahelper::GetSystemTime_ns();
+  auto elapsed = [](sup::dto::uint64 from, sup::dto::uint64 to){
+    return to > from ? to - from : 0;
+  };
+  if (info.timestamp > 0)
+  {
+    if (info.receive_time < info.timestamp)
+    {
+      ++m_latency_metrics->negative_skew_count;
+    }
+    else
+    {
+      m_latency_metrics->ioc_to_receive.Record(info.receive_time - info.timestamp);
+    }
+  }
+  m_latency_metrics->receive_to_decode.Record(elapsed(info.receive_time, info.decode_time));
+  m_latency_metrics->decode_to_delivery.Record(elapsed(info.decode_time, delivery_time));
+  m_latency_metrics->receive_to_delivery.Record(elapsed(info.receive_time, delivery_time));
+}
+
 }  // namespace epics
 
 }  // namespace sup
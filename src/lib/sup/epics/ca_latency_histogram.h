@@ -0,0 +1,131 @@
+/******************************************************************************
+ *
+ * Project       : Supervision and automation system EPICS interface
+ *
+ * Description   : Library of SUP components for EPICS network protocol
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_EPICS_CA_LATENCY_HISTOGRAM_H_
+#define SUP_EPICS_CA_LATENCY_HISTOGRAM_H_
+
+#include <sup/dto/basic_scalar_types.h>
+
+#include <vector>
+
+namespace sup
+{
+namespace epics
+{
+/**
+ * @brief CALatencyHistogram records latencies in nanoseconds with bounded relative error.
+ *
+ * @details Values below 32ns are counted exactly. Larger values are counted in logarithmic
+ * buckets (one per power of two) that are each divided into 16 linear sub-buckets, which bounds
+ * the relative error on reported values to about 6%. Values above 2^40ns (about 18 minutes) are
+ * counted in the last bucket. Recording a value is constant time and never allocates.
+ *
+ * @note This class is not thread safe.
+ */
+class CALatencyHistogram
+{
+public:
+  CALatencyHistogram();
+  ~CALatencyHistogram();
+
+  CALatencyHistogram(const CALatencyHistogram& other);
+  CALatencyHistogram(CALatencyHistogram&& other);
+  CALatencyHistogram& operator=(const CALatencyHistogram& other);
+  CALatencyHistogram& operator=(CALatencyHistogram&& other);
+
+  /**
+   * @brief Record a single latency.
+   *
+   * @param value_ns Latency in nanoseconds.
+   */
+  void Record(sup::dto::uint64 value_ns);
+
+  /**
+   * @brief Clear all recorded values.
+   */
+  void Reset();
+
+  /**
+   * @brief Retrieve the number of recorded values.
+   */
+  sup::dto::uint64 GetCount() const;
+
+  /**
+   * @brief Retrieve the smallest recorded value or zero if nothing was recorded.
+   */
+  sup::dto::uint64 GetMin() const;
+
+  /**
+   * @brief Retrieve the largest recorded value or zero if nothing was recorded.
+   */
+  sup::dto::uint64 GetMax() const;
+
+  /**
+   * @brief Retrieve the mean of the recorded values or zero if nothing was recorded.
+   */
+  double GetMean() const;
+
+  /**
+   * @brief Retrieve the value below or equal to which the given percentage of recorded values
+   * fall.
+   *
+   * @param percentile Percentage in the range [0, 100].
+   *
+   * @return Upper bound of the bucket containing the requested percentile, limited to the largest
+   * recorded value, or zero if nothing was recorded.
+   */
+  sup::dto::uint64 GetValueAtPercentile(double percentile) const;
+
+private:
+  std::vector<sup::dto::uint64> m_counts;
+  sup::dto::uint64 m_total_count;
+  sup::dto::uint64 m_min;
+  sup::dto::uint64 m_max;
+  double m_sum;
+};
+
+/**
+ * @brief End-to-end latencies of monitor updates of a single channel.
+ *
+ * @details All timestamps are taken from the system clock in order to compare them with the
+ * timestamps of the IOC. The receive time is taken on entry of the CA monitor callback, the decode
+ * time after conversion of the payload to an AnyValue and the delivery time after the user's
+ * callback returned.
+ */
+struct CALatencyMetrics
+{
+  /**
+   * @brief Time between the IOC's timestamp of the update and its reception by the client.
+   *
+   * @note Since this depends on clock synchronization between IOC and client, negative values are
+   * not recorded in the histogram, but counted in negative_skew_count.
+   */
+  CALatencyHistogram ioc_to_receive;
+  CALatencyHistogram receive_to_decode;
+  CALatencyHistogram decode_to_delivery;
+  CALatencyHistogram receive_to_delivery;
+  sup::dto::uint64 negative_skew_count;
+};
+
+}  // namespace epics
+
+}  // namespace sup
+
+#endif  // SUP_EPICS_CA_LATENCY_HISTOGRAM_H_
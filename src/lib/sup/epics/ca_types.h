@@ -23,8 +23,10 @@
 
 #include <sup/dto/anyvalue.h>
 
+#include <array>
 #include <functional>
 #include <string>
+#include <utility>
 
 namespace sup
 {
@@ -33,17 +35,134 @@ namespace epics
 
 using ChannelID = sup::dto::uint64;
 
+/**
+ * @brief Information passed to the monitor callback of a channel.
+ *
+ * @details The timestamp is the IOC's timestamp of the update. The receive and decode times are
+ * client side system clock times (in ns since the epoch) taken when entering the CA monitor
+ * callback and after decoding the value respectively.
+ */
 struct CAMonitorInfo
 {
   sup::dto::uint64 timestamp;
   sup::dto::int16 status;
   sup::dto::int16 severity;
   sup::dto::AnyValue value;
+  sup::dto::uint64 receive_time;
+  sup::dto::uint64 decode_time;
 };
 
+/**
+ * @brief Type name of character arrays that represent long strings.
+ *
+ * @details Channels with such a type are transferred as DBR_CHAR arrays (e.g. waveform records
+ * with FTVL=CHAR or lsi/lso records), but their values are presented as strings.
+ */
+const std::string kLongStringTypeName = "sup::epics::LongString";
+
+/**
+ * @brief Create the type for a long string channel.
+ *
+ * @param max_length Maximum number of characters, including the terminating null character, i.e.
+ * the number of elements of the channel.
+ *
+ * @return Character array type that is decoded as a string.
+ */
+sup::dto::AnyType LongStringType(sup::dto::uint64 max_length);
+
+/**
+ * @brief Check if the given type denotes a long string channel.
+ */
+bool IsLongStringType(const sup::dto::AnyType& anytype);
+
+/**
+ * @brief Quality of service classes for Channel Access channels.
+ *
+ * @details Each class maps to a CA dispatch priority. The CA client library opens a separate
+ * virtual circuit to a server for each priority in use, so channels of different classes do not
+ * share a TCP connection and the server handles requests of higher priority first.
+ */
+enum class CAQoSClass
+{
+  kBulk,
+  kDefault,
+  kCritical
+};
+
+const std::string kCAQoSBulk = "bulk";
+const std::string kCAQoSDefault = "default";
+const std::string kCAQoSCritical = "critical";
+
+/**
+ * @brief Retrieve the CA priority (in the range [0, 99]) for the given quality of service class.
+ */
+sup::dto::uint32 CAPriority(CAQoSClass qos_class);
+
+/**
+ * @brief Parse a quality of service class from its name ('bulk', 'default' or 'critical').
+ *
+ * @return Pair of success flag and parsed class.
+ */
+std::pair<bool, CAQoSClass> ParseCAQoSClass(const std::string& name);
+
 using ConnectionCallBack = std::function<void(bool)>;
 using MonitorCallBack = std::function<void(const CAMonitorInfo&)>;
 
+/**
+ * @brief Interface for receiving connection and monitor events of a single channel.
+ *
+ * @details Events are dispatched by a direct virtual call from the Channel Access callbacks,
+ * without intermediate type erasure. The listener has to outlive the channel it was registered
+ * for.
+ */
+class CAChannelListener
+{
+public:
+  virtual ~CAChannelListener() = default;
+
+  virtual void OnConnectionChanged(bool connected) = 0;
+  virtual void OnMonitorCalled(const CAMonitorInfo& info) = 0;
+};
+
+/**
+ * @brief Number of bins in the decode time histogram of CAChannelMetrics.
+ *
+ * @details Bin 0 counts decode times below 1us, bin i (i > 0) counts decode times in the interval
+ * [2^(i-1), 2^i) us. The last bin also counts all longer decode times.
+ */
+const std::size_t kCADecodeHistogramBins = 16;
+
+/**
+ * @brief Snapshot of the counters of a single Channel Access channel since its creation.
+ */
+struct CAChannelMetrics
+{
+  sup::dto::uint64 monitors_received;
+  sup::dto::uint64 bytes_decoded;
+  sup::dto::uint64 decode_failures;
+  sup::dto::uint64 connections;
+  sup::dto::uint64 disconnections;
+  sup::dto::uint64 puts;
+  sup::dto::uint64 put_latency_total_ns;
+  sup::dto::uint64 put_latency_max_ns;
+  std::array<sup::dto::uint64, kCADecodeHistogramBins> decode_time_histogram;
+};
+
+/**
+ * @brief Snapshot of the counters of the shared Channel Access context since its creation.
+ *
+ * @note The wait time of a task is the time between queueing it and the start of its execution
+ * in the context's thread.
+ */
+struct CAContextMetrics
+{
+  sup::dto::uint64 tasks_handled;
+  sup::dto::uint64 queue_depth;
+  sup::dto::uint64 max_queue_depth;
+  sup::dto::uint64 task_wait_total_ns;
+  sup::dto::uint64 task_wait_max_ns;
+};
+
 }  // namespace epics
 
 }  // namespace sup
@@ -64,10 +64,12 @@ public:
    *
    * @param channel EPICS channel name.
    * @param type Type to use for this variable.
+   * @param qos_class Quality of service class of the channel.
    *
    * @return True if variable was successfully constructed, false otherwise.
    */
-  bool AddVariable(const std::string& channel, const sup::dto::AnyType& type);
+  bool AddVariable(const std::string& channel, const sup::dto::AnyType& type,
+                   CAQoSClass qos_class = CAQoSClass::kDefault);
 
     /**
    * @brief Retrieve the names of all managed channels.
@@ -143,6 +145,42 @@ public:
    */
   bool RemoveVariable(const std::string& channel);
 
+  /**
+   * @brief Retrieve a snapshot of the metrics of a specific channel.
+   *
+   * @param channel EPICS channel name.
+   *
+   * @return Channel metrics or zero-initialized metrics if the channel is not managed.
+   */
+  CAChannelMetrics GetMetrics(const std::string& channel) const;
+
+  /**
+   * @brief Retrieve a snapshot of the metrics of the shared Channel Access context.
+   *
+   * @return Context metrics, e.g. task queue depth and waiting times.
+   */
+  CAContextMetrics GetContextMetrics() const;
+
+  /**
+   * @brief Enable or disable the tracing of monitor update latencies for a specific channel.
+   *
+   * @param channel EPICS channel name.
+   * @param enable Enable tracing when true, disable it otherwise.
+   *
+   * @return True if the channel is managed by this client, false otherwise.
+   */
+  bool EnableLatencyTracing(const std::string& channel, bool enable);
+
+  /**
+   * @brief Retrieve a snapshot of the latencies of monitor updates of a specific channel.
+   *
+   * @param channel EPICS channel name.
+   *
+   * @return Latency histograms or empty histograms if the channel is not managed or tracing is
+   * disabled.
+   */
+  CALatencyMetrics GetLatencyMetrics(const std::string& channel) const;
+
 private:
   void OnVariableUpdated(const std::string& channel, const ChannelAccessPV::ExtendedValue& value);
   VariableUpdatedCallback var_updated_cb;  // Order matters: the callback has to outlive the PVs
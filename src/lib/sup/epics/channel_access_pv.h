@@ -21,16 +21,18 @@
 #ifndef SUP_EPICS_CHANNEL_ACCESS_PV_H_
 #define SUP_EPICS_CHANNEL_ACCESS_PV_H_
 
+#include <sup/epics/ca_latency_histogram.h>
 #include <sup/epics/ca_types.h>
 
 #include <condition_variable>
+#include <memory>
 #include <mutex>
 
 namespace sup
 {
 namespace epics
 {
-class ChannelAccessPV
+class ChannelAccessPV : private CAChannelListener
 {
 public:
   struct ExtendedValue
@@ -49,6 +51,7 @@ public:
    * @param channel EPICS channel name.
    * @param type Type to use for the connected channel.
    * @param cb Callback function to call when the variable's value or status changed.
+   * @param qos_class Quality of service class of the channel.
    *
    * @details The optional callback will be called while holding an internal lock that is also
    * used for any read operation on the PV (IsConnected/GetValue/etc.) So be aware for deadlocks
@@ -60,12 +63,12 @@ public:
    * related to the fact that the specific PV might not be connected).
    */
   ChannelAccessPV(const std::string& channel, const sup::dto::AnyType& type,
-                  VariableChangedCallback cb = {});
+                  VariableChangedCallback cb = {}, CAQoSClass qos_class = CAQoSClass::kDefault);
 
     /**
    * @brief Destructor.
    */
-  ~ChannelAccessPV();
+  ~ChannelAccessPV() override;
 
     /**
    * @brief Deleted copy/move constructor/assigment.
@@ -89,6 +92,13 @@ public:
    */
   std::string GetChannelName() const;
 
+    /**
+   * @brief Retrieve the quality of service class of the variable's channel.
+   *
+   * @return Quality of service class.
+   */
+  CAQoSClass GetQoSClass() const;
+
     /**
    * @brief Retrieve the variable's value.
    *
@@ -131,15 +141,42 @@ public:
    */
   bool WaitForValidValue(double timeout_sec) const;
 
+  /**
+   * @brief Retrieve a snapshot of the channel's metrics.
+   *
+   * @return Counters for monitor updates, decoding, connection changes and puts.
+   */
+  CAChannelMetrics GetMetrics() const;
+
+  /**
+   * @brief Enable or disable the tracing of monitor update latencies.
+   *
+   * @param enable Enable tracing when true, disable it otherwise.
+   *
+   * @details Enabling the tracing clears all previously recorded latencies. Tracing is disabled
+   * by default.
+   */
+  void EnableLatencyTracing(bool enable);
+
+  /**
+   * @brief Retrieve a snapshot of the latencies of monitor updates.
+   *
+   * @return Latency histograms or empty histograms if tracing is disabled.
+   */
+  CALatencyMetrics GetLatencyMetrics() const;
+
 private:
-  void OnConnectionChanged(bool connected);
-  void OnMonitorCalled(const CAMonitorInfo& info);
+  void OnConnectionChanged(bool connected) override;
+  void OnMonitorCalled(const CAMonitorInfo& info) override;
+  void RecordLatencies(const CAMonitorInfo& info);
   const std::string m_channel_name;
+  const CAQoSClass m_qos_class;
   ExtendedValue m_cache;
   ChannelID m_id;
   mutable std::mutex m_mon_mtx;
   mutable std::condition_variable m_monitor_cv;
   VariableChangedCallback m_var_changed_cb;
+  std::unique_ptr<CALatencyMetrics> m_latency_metrics;
 };
 }  // namespace epics
 
@@ -21,8 +21,11 @@
 #ifndef SUP_EPICS_EPICS_PROTOCOL_FACTORY_H_
 #define SUP_EPICS_EPICS_PROTOCOL_FACTORY_H_
 
+#include <sup/epics/ca_types.h>
+#include <sup/epics/pv_access_client_pv.h>
 #include <sup/epics/pv_access_rpc_client_config.h>
 #include <sup/epics/pv_access_rpc_server_config.h>
+#include <sup/epics/pv_access_server.h>
 
 #include <sup/protocol/log_any_functor_decorator.h>
 #include <sup/protocol/protocol_factory.h>
@@ -35,6 +38,10 @@ namespace epics
 // Constants for RPC clients/servers:
 const std::string kServiceName = "ServiceName";
 const std::string kTimeout = "Timeout";
+const std::string kContextName = "Context";
+const std::string kHandlerThreads = "HandlerThreads";
+const std::string kMaxPendingRequests = "MaxPendingRequests";
+const std::string kMaxInFlightRequests = "MaxInFlightRequests";
 
 // Constants for ProcessVariables:
 // Class of ProcessVariable
@@ -46,6 +53,12 @@ const std::string kPvAccessServerClass = "PvAccessServer";
 const std::string kChannelName = "ChannelName";
 const std::string kVariableType = "VarType";
 const std::string kVariableValue = "VarValue";
+const std::string kQoSClass = "QoS";
+const std::string kFieldSelection = "Fields";
+const std::string kQueueSize = "QueueSize";
+const std::string kPipeline = "Pipeline";
+const std::string kServerGroup = "ServerGroup";
+const std::string kMaxPostRate = "MaxPostRate";
 
 class EPICSProtocolFactory : public sup::protocol::ProtocolFactory
 {
@@ -65,9 +78,21 @@ public:
    * Depending on the class type, extra fields can be defined:
    *    - For 'ChannelAccessClient':
    *      - VarType: mandatory string providing the JSON representation of its AnyType.
-   *    - For 'PvAccessClient': none.
+   *      - QoS: optional string providing the quality of service class of the channel:
+   *             'bulk', 'default' or 'critical'. Default is 'default'.
+   *    - For 'PvAccessClient':
+   *      - Fields: optional string providing a comma separated list of the fields to subscribe to
+   *                (e.g. 'value,timeStamp'). Default is the complete structure.
+   *      - QueueSize: optional uint32 providing the size of the server's monitor queue.
+   *      - Pipeline: optional boolean to enable flow control of the monitor. Default is false.
+   *      - Context: optional string providing the name of the client context to use. Default
+   *                 is the shared client context.
    *    - For 'PvAccessServer':
    *      - VarValue: mandatory AnyValue providing the initial value of the network variable.
+   *      - ServerGroup: optional string providing the name of the group of server variables that
+   *                     share a single PvAccess server. Default is the unnamed group.
+   *      - MaxPostRate: optional float64 providing the maximum number of posts per second to the
+   *                     clients. Zero (default) disables rate limiting.
    *
    * @return EPICS ProcessVariable.
    */
@@ -79,8 +104,15 @@ public:
    *
    * @param protocol Protocol to inject.
    * @param server_definition Configuration for the server. This is an AnyValue structure with
-   * the following field:
-   *   - ServiceName: mandatory string providing the service name on the network.
+   * the following fields:
+   *   - ServiceName: mandatory string providing the service name on the network,
+   *   - HandlerThreads: optional uint32 providing the number of threads that handle requests
+   *                     concurrently. Default is 0, which handles requests one by one in the
+   *                     network thread,
+   *   - MaxPendingRequests: optional uint32 providing the maximum number of requests that wait
+   *                         for a free handler thread. Default is 0 (no limit),
+   *   - MaxInFlightRequests: optional uint32 providing the maximum number of requests that are
+   *                          accepted and not replied yet. Default is 0 (no limit).
    *
    * @return EPICS RPC server stack.
    */
@@ -99,6 +131,8 @@ public:
    *   - Encoding: optional string field providing the encoding used for the encapsulated
    *               ProtocolRPCClient. Supported encodings are: 'None' and 'Base64'. Default is
    *               'Base64'.
+   *   - Context: optional string providing the name of the client context to use. Default is
+   *              the shared client context.
    *
    * @return EPICS RPC client stack.
    */
@@ -111,29 +145,39 @@ public:
  *
  * @param channel Channel name.
  * @param var_type Variable AnyType.
+ * @param qos_class Quality of service class of the channel.
  * @return EPICS ProcessVariable.
  */
 std::unique_ptr<sup::protocol::ProcessVariable> CreateCAClientProcessVariable(
-  const std::string& channel, const sup::dto::AnyType& var_type);
+  const std::string& channel, const sup::dto::AnyType& var_type,
+  CAQoSClass qos_class = CAQoSClass::kDefault);
 
 /**
  * @brief Helper function to create an EPICS PvAccess client ProcessVariable.
  *
  * @param channel Channel name.
+ * @param config Configuration of the client variable.
  * @return EPICS ProcessVariable.
  */
 std::unique_ptr<sup::protocol::ProcessVariable> CreatePVAClientProcessVariable(
-  const std::string& channel);
+  const std::string& channel, const PvAccessClientPVConfig& config = GetDefaultClientPVConfig());
 
 /**
  * @brief Helper function to create an EPICS PvAccess server ProcessVariable.
  *
  * @param channel Channel name.
  * @param value Initial value.
+ * @param server_group Name of the group of server variables that share a single PvAccess server.
+ * @param config Configuration of the server variable.
  * @return EPICS ProcessVariable.
+ *
+ * @note The shared server of a group is started when its first variable is created and stopped
+ * when its last variable is destroyed. Channel names have to be unique within a group.
  */
 std::unique_ptr<sup::protocol::ProcessVariable> CreatePVAServerProcessVariable(
-  const std::string& channel, const sup::dto::AnyValue& value);
+  const std::string& channel, const sup::dto::AnyValue& value,
+  const std::string& server_group = {},
+  const PvAccessServerPVConfig& config = GetDefaultServerPVConfig());
 
 /**
  * @brief Helper function to create an EPICS RPC server stack with an injected Protocol.
@@ -27,7 +27,8 @@ namespace sup
 namespace epics
 {
 ChannelAccessPVWrapper::ChannelAccessPVWrapper(const std::string& channel,
-                                               const sup::dto::AnyType& type)
+                                               const sup::dto::AnyType& type,
+                                               CAQoSClass qos_class)
   : m_callback{}
   , m_cb_mtx{}
   , m_pv_impl{}
@@ -35,7 +36,7 @@ ChannelAccessPVWrapper::ChannelAccessPVWrapper(const std::string& channel,
   auto callback = [this](const ChannelAccessPV::ExtendedValue& val){
     return OnUpdate(val);
   };
-  m_pv_impl = std::make_unique<ChannelAccessPV>(channel, type, callback);
+  m_pv_impl = std::make_unique<ChannelAccessPV>(channel, type, callback, qos_class);
 }
 
 ChannelAccessPVWrapper::~ChannelAccessPVWrapper() = default;
@@ -35,7 +35,8 @@ namespace epics
 class ChannelAccessPVWrapper : public sup::protocol::ProcessVariable
 {
 public:
-  ChannelAccessPVWrapper(const std::string& channel, const sup::dto::AnyType& type);
+  ChannelAccessPVWrapper(const std::string& channel, const sup::dto::AnyType& type,
+                         CAQoSClass qos_class = CAQoSClass::kDefault);
   ~ChannelAccessPVWrapper() override;
 
   bool IsAvailable() const override;
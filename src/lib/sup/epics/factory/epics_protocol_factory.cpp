@@ -80,21 +80,22 @@ std::unique_ptr<sup::protocol::Protocol> EPICSProtocolFactory::CreateRPCClient(
 }
 
 std::unique_ptr<sup::protocol::ProcessVariable> CreateCAClientProcessVariable(
-  const std::string& channel, const sup::dto::AnyType& var_type)
+  const std::string& channel, const sup::dto::AnyType& var_type, CAQoSClass qos_class)
 {
-  return std::make_unique<ChannelAccessPVWrapper>(channel, var_type);
+  return std::make_unique<ChannelAccessPVWrapper>(channel, var_type, qos_class);
 }
 
 std::unique_ptr<sup::protocol::ProcessVariable> CreatePVAClientProcessVariable(
-  const std::string& channel)
+  const std::string& channel, const PvAccessClientPVConfig& config)
 {
-  return std::make_unique<PVAccessClientPVWrapper>(channel);
+  return std::make_unique<PVAccessClientPVWrapper>(channel, config);
 }
 
 std::unique_ptr<sup::protocol::ProcessVariable> CreatePVAServerProcessVariable(
-  const std::string& channel, const sup::dto::AnyValue& value)
+  const std::string& channel, const sup::dto::AnyValue& value, const std::string& server_group,
+  const PvAccessServerPVConfig& config)
 {
-  return std::make_unique<PVAccessServerPVWrapper>(channel, value);
+  return std::make_unique<PVAccessServerPVWrapper>(channel, value, server_group, config);
 }
 
 std::unique_ptr<sup::protocol::RPCServerInterface> CreateEPICSRPCServerStack(
@@ -21,6 +21,7 @@
 #include "epics_protocol_factory_utils.h"
 
 #include <sup/epics/epics_protocol_factory.h>
+#include <sup/epics/pv_access_client_context.h>
 #include <sup/epics/pv_access_rpc_server.h>
 
 #include <sup/dto/anyvalue.h>
@@ -28,6 +29,11 @@
 #include <sup/protocol/exceptions.h>
 #include <sup/protocol/protocol_factory_utils.h>
 
+namespace
+{
+std::string ParseContextName(const sup::dto::AnyValue& config);
+}  // unnamed namespace
+
 namespace sup
 {
 namespace epics
@@ -38,25 +44,46 @@ PvAccessRPCServerConfig ParsePvAccessRPCServerConfig(const sup::dto::AnyValue& c
 {
   sup::protocol::ValidateConfigurationField(config, kServiceName, sup::dto::StringType);
   auto service_name = config[kServiceName].As<std::string>();
-  return GetDefaultRPCServerConfig(service_name);
+  auto result = GetDefaultRPCServerConfig(service_name);
+  if (config.HasField(kHandlerThreads))
+  {
+    sup::protocol::ValidateConfigurationField(config, kHandlerThreads,
+                                              sup::dto::UnsignedInteger32Type);
+    result.handler_threads = config[kHandlerThreads].As<sup::dto::uint32>();
+  }
+  if (config.HasField(kMaxPendingRequests))
+  {
+    sup::protocol::ValidateConfigurationField(config, kMaxPendingRequests,
+                                              sup::dto::UnsignedInteger32Type);
+    result.max_pending_requests = config[kMaxPendingRequests].As<sup::dto::uint32>();
+  }
+  if (config.HasField(kMaxInFlightRequests))
+  {
+    sup::protocol::ValidateConfigurationField(config, kMaxInFlightRequests,
+                                              sup::dto::UnsignedInteger32Type);
+    result.max_in_flight_requests = config[kMaxInFlightRequests].As<sup::dto::uint32>();
+  }
+  return result;
 }
 
 PvAccessRPCClientConfig ParsePvAccessRPCClientConfig(const sup::dto::AnyValue& config)
 {
   sup::protocol::ValidateConfigurationField(config, kServiceName, sup::dto::StringType);
   auto service_name = config[kServiceName].As<std::string>();
-  if (!config.HasField(kTimeout))
+  auto result = GetDefaultRPCClientConfig(service_name);
+  if (config.HasField(kTimeout))
   {
-    return GetDefaultRPCClientConfig(service_name);
+    sup::protocol::ValidateConfigurationField(config, kTimeout, sup::dto::Float64Type);
+    double timeout = config[kTimeout].As<double>();
+    if (timeout < 0.0)
+    {
+      const std::string error = "Cannot not use negative timeout for PvAccessRPCClient";
+      throw sup::protocol::InvalidOperationException(error);
+    }
+    result.timeout = timeout;
   }
-  sup::protocol::ValidateConfigurationField(config, kTimeout, sup::dto::Float64Type);
-  double timeout = config[kTimeout].As<double>();
-  if (timeout < 0.0)
-  {
-    const std::string error = "Cannot not use negative timeout for PvAccessRPCClient";
-    throw sup::protocol::InvalidOperationException(error);
-  }
-  return PvAccessRPCClientConfig{service_name, timeout};
+  result.context_name = ParseContextName(config);
+  return result;
 }
 
 std::unique_ptr<sup::protocol::ProcessVariable> CreateChannelAccessClientVar(
@@ -72,7 +99,21 @@ std::unique_ptr<sup::protocol::ProcessVariable> CreateChannelAccessClientVar(
     const std::string error = "Cannot parse type for ChannelAccessClient ProcessVariable";
     throw sup::protocol::InvalidOperationException(error);
   }
-  return CreateCAClientProcessVariable(channel_name, parser.MoveAnyType());
+  auto qos_class = CAQoSClass::kDefault;
+  if (config.HasField(kQoSClass))
+  {
+    sup::protocol::ValidateConfigurationField(config, kQoSClass, sup::dto::StringType);
+    auto qos_name = config[kQoSClass].As<std::string>();
+    auto [parsed, parsed_class] = ParseCAQoSClass(qos_name);
+    if (!parsed)
+    {
+      const std::string error =
+        "Unknown quality of service class for ChannelAccessClient ProcessVariable: " + qos_name;
+      throw sup::protocol::InvalidOperationException(error);
+    }
+    qos_class = parsed_class;
+  }
+  return CreateCAClientProcessVariable(channel_name, parser.MoveAnyType(), qos_class);
 }
 
 std::unique_ptr<sup::protocol::ProcessVariable> CreatePvAccessClientVar(
@@ -80,7 +121,25 @@ std::unique_ptr<sup::protocol::ProcessVariable> CreatePvAccessClientVar(
 {
   sup::protocol::ValidateConfigurationField(config, kChannelName, sup::dto::StringType);
   auto channel_name = config[kChannelName].As<std::string>();
-  return CreatePVAClientProcessVariable(channel_name);
+  auto pv_config = GetDefaultClientPVConfig();
+  if (config.HasField(kFieldSelection))
+  {
+    sup::protocol::ValidateConfigurationField(config, kFieldSelection, sup::dto::StringType);
+    pv_config.fields = config[kFieldSelection].As<std::string>();
+  }
+  if (config.HasField(kQueueSize))
+  {
+    sup::protocol::ValidateConfigurationField(config, kQueueSize,
+                                              sup::dto::UnsignedInteger32Type);
+    pv_config.queue_size = config[kQueueSize].As<sup::dto::uint32>();
+  }
+  if (config.HasField(kPipeline))
+  {
+    sup::protocol::ValidateConfigurationField(config, kPipeline, sup::dto::BooleanType);
+    pv_config.pipeline = config[kPipeline].As<sup::dto::boolean>();
+  }
+  pv_config.context_name = ParseContextName(config);
+  return CreatePVAClientProcessVariable(channel_name, pv_config);
 }
 
 std::unique_ptr<sup::protocol::ProcessVariable> CreatePvAccessServerVar(
@@ -93,7 +152,26 @@ std::unique_ptr<sup::protocol::ProcessVariable> CreatePvAccessServerVar(
     const std::string error = "Cannot find value for PvAccessServer ProcessVariable";
     throw sup::protocol::InvalidOperationException(error);
   }
-  return CreatePVAServerProcessVariable(channel_name, config[kVariableValue]);
+  std::string server_group;
+  if (config.HasField(kServerGroup))
+  {
+    sup::protocol::ValidateConfigurationField(config, kServerGroup, sup::dto::StringType);
+    server_group = config[kServerGroup].As<std::string>();
+  }
+  auto pv_config = GetDefaultServerPVConfig();
+  if (config.HasField(kMaxPostRate))
+  {
+    sup::protocol::ValidateConfigurationField(config, kMaxPostRate, sup::dto::Float64Type);
+    double max_post_rate = config[kMaxPostRate].As<double>();
+    if (max_post_rate < 0.0)
+    {
+      const std::string error = "Cannot use negative maximum post rate for PvAccessServer";
+      throw sup::protocol::InvalidOperationException(error);
+    }
+    pv_config.max_post_rate = max_post_rate;
+  }
+  return CreatePVAServerProcessVariable(channel_name, config[kVariableValue], server_group,
+                                        pv_config);
 }
 
 LoggingEPICSRPCClient::LoggingEPICSRPCClient(
@@ -113,3 +191,24 @@ sup::dto::AnyValue LoggingEPICSRPCClient::operator()(const sup::dto::AnyValue& i
 }  // namespace epics
 
 }  // namespace sup
+
+namespace
+{
+std::string ParseContextName(const sup::dto::AnyValue& config)
+{
+  if (!config.HasField(sup::epics::kContextName))
+  {
+    return {};
+  }
+  sup::protocol::ValidateConfigurationField(config, sup::epics::kContextName,
+                                            sup::dto::StringType);
+  auto context_name = config[sup::epics::kContextName].As<std::string>();
+  if (!sup::epics::HasPvAccessClientContext(context_name))
+  {
+    const std::string error = "Unknown PvAccess client context: " + context_name;
+    throw sup::protocol::InvalidOperationException(error);
+  }
+  return context_name;
+}
+
+}  // unnamed namespace
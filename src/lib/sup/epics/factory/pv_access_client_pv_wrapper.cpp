@@ -26,7 +26,8 @@ namespace sup
 {
 namespace epics
 {
-PVAccessClientPVWrapper::PVAccessClientPVWrapper(const std::string& channel)
+PVAccessClientPVWrapper::PVAccessClientPVWrapper(const std::string& channel,
+                                                 const PvAccessClientPVConfig& config)
   : m_callback{}
   , m_cb_mtx{}
   , m_pv_impl{}
@@ -34,7 +35,7 @@ PVAccessClientPVWrapper::PVAccessClientPVWrapper(const std::string& channel)
   auto callback = [this](const PvAccessClientPV::ExtendedValue& val){
     return OnUpdate(val);
   };
-  m_pv_impl = std::make_unique<PvAccessClientPV>(channel, callback);
+  m_pv_impl = std::make_unique<PvAccessClientPV>(channel, config, callback);
 }
 
 PVAccessClientPVWrapper::~PVAccessClientPVWrapper() = default;
@@ -35,7 +35,7 @@ namespace epics
 class PVAccessClientPVWrapper : public sup::protocol::ProcessVariable
 {
 public:
-  explicit PVAccessClientPVWrapper(const std::string& channel);
+  PVAccessClientPVWrapper(const std::string& channel, const PvAccessClientPVConfig& config);
   ~PVAccessClientPVWrapper() override;
 
   bool IsAvailable() const override;
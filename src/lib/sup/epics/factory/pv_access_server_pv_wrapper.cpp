@@ -20,6 +20,8 @@
 
 #include "pv_access_server_pv_wrapper.h"
 
+#include <sup/epics/pvxs/pv_access_utils.h>
+
 #include <sup/protocol/exceptions.h>
 
 namespace sup
@@ -27,21 +29,26 @@ namespace sup
 namespace epics
 {
 PVAccessServerPVWrapper::PVAccessServerPVWrapper(const std::string& channel,
-                                                 const sup::dto::AnyValue& value)
+                                                 const sup::dto::AnyValue& value,
+                                                 const std::string& server_group,
+                                                 const PvAccessServerPVConfig& config)
   : m_channel{channel}
   , m_callback{}
   , m_cb_mtx{}
-  , m_server{}
+  , m_server{utils::GetSharedServer(server_group)}
+  , m_variable{}
 {
-  auto callback = [this](const std::string&, const sup::dto::AnyValue& val){
+  auto callback = [this](const sup::dto::AnyValue& val){
     return OnUpdate(val);
   };
-  m_server = std::make_unique<PvAccessServer>(callback);
-  m_server->AddVariable(m_channel, value);
-  m_server->Start();
+  m_variable = std::make_unique<PvAccessServerPV>(m_channel, value, callback, config);
+  m_variable->AddToServer(*m_server);
 }
 
-PVAccessServerPVWrapper::~PVAccessServerPVWrapper() = default;
+PVAccessServerPVWrapper::~PVAccessServerPVWrapper()
+{
+  m_variable->RemoveFromServer(*m_server);
+}
 
 bool PVAccessServerPVWrapper::IsAvailable() const
 {
@@ -51,13 +58,13 @@ bool PVAccessServerPVWrapper::IsAvailable() const
 std::pair<bool, sup::dto::AnyValue> PVAccessServerPVWrapper::GetValue(double timeout_sec) const
 {
   (void)timeout_sec;
-  return { true, m_server->GetValue(m_channel) };
+  return { true, m_variable->GetValue() };
 }
 
 bool PVAccessServerPVWrapper::SetValue(const sup::dto::AnyValue& value, double timeout_sec)
 {
   (void)timeout_sec;
-  return m_server->SetValue(m_channel, value);
+  return m_variable->SetValue(value);
 }
 
 bool PVAccessServerPVWrapper::WaitForAvailable(double timeout_sec) const
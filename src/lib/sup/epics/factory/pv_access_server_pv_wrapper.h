@@ -21,21 +21,28 @@
 #ifndef SUP_EPICS_PV_ACCESS_SERVER_PV_WRAPPER_H_
 #define SUP_EPICS_PV_ACCESS_SERVER_PV_WRAPPER_H_
 
-#include <sup/epics/pv_access_server.h>
+#include <sup/epics/pvxs/pv_access_server_pv.h>
 
 #include <sup/protocol/process_variable.h>
 
+#include <memory>
 #include <mutex>
+#include <string>
 
 namespace sup
 {
 namespace epics
 {
 
+//! ProcessVariable that publishes a single variable on the server that is shared by all wrappers of
+//! the same server group.
+
 class PVAccessServerPVWrapper : public sup::protocol::ProcessVariable
 {
 public:
-  PVAccessServerPVWrapper(const std::string& channel, const sup::dto::AnyValue& value);
+  PVAccessServerPVWrapper(const std::string& channel, const sup::dto::AnyValue& value,
+                          const std::string& server_group = {},
+                          const PvAccessServerPVConfig& config = GetDefaultServerPVConfig());
   ~PVAccessServerPVWrapper() override;
 
   bool IsAvailable() const override;
@@ -48,7 +55,8 @@ private:
   std::string m_channel;
   sup::protocol::ProcessVariable::Callback m_callback;
   std::mutex m_cb_mtx;
-  std::unique_ptr<PvAccessServer> m_server;
+  std::shared_ptr<pvxs::server::Server> m_server;
+  std::unique_ptr<PvAccessServerPV> m_variable;
 };
 
 }  // namespace epics
@@ -0,0 +1,72 @@
+/******************************************************************************
+ *
+ * Project       : Supervision and automation system EPICS interface
+ *
+ * Description   : Library of SUP components for EPICS network protocol
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_EPICS_PV_ACCESS_ARRAY_VIEW_H_
+#define SUP_EPICS_PV_ACCESS_ARRAY_VIEW_H_
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace sup
+{
+namespace epics
+{
+/**
+ * @brief Read-only view on a scalar array as received from or published to PvAccess.
+ *
+ * @details The view shares ownership of the array's buffer, so it remains valid after newer
+ * updates replaced the array in a client's cache. When publishing, the buffer is shared with the
+ * server variable and must not be modified afterwards. No element is copied or converted.
+ */
+template <typename T>
+class PvAccessArrayView
+{
+public:
+  PvAccessArrayView()
+    : m_data{}
+    , m_size{0}
+  {}
+
+  PvAccessArrayView(std::shared_ptr<const T> data, std::size_t size)
+    : m_data{std::move(data)}
+    , m_size{m_data ? size : 0}
+  {}
+
+  const T* data() const { return m_data.get(); }
+  const std::shared_ptr<const T>& shared_data() const { return m_data; }
+  std::size_t size() const { return m_size; }
+  bool empty() const { return m_size == 0; }
+
+  const T* begin() const { return data(); }
+  const T* end() const { return data() + m_size; }
+
+  const T& operator[](std::size_t idx) const { return m_data.get()[idx]; }
+
+private:
+  std::shared_ptr<const T> m_data;
+  std::size_t m_size;
+};
+
+}  // namespace epics
+
+}  // namespace sup
+
+#endif  // SUP_EPICS_PV_ACCESS_ARRAY_VIEW_H_
@@ -24,6 +24,7 @@
 #include <sup/epics/pv_access_client_pv.h>
 
 #include <functional>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -49,6 +50,15 @@ public:
    */
   explicit PvAccessClient(VariableChangedCallback cb = {});
 
+  /**
+   * @brief Constructor with a named client context.
+   *
+   * @param context_name Name of the client context to use for this client's operations and for
+   * variables without an explicit context in their configuration.
+   * @param cb Callback function to call when the variable's value or status changed.
+   */
+  PvAccessClient(const std::string& context_name, VariableChangedCallback cb);
+
   /**
    * @brief Constructor.
    *
@@ -71,6 +81,15 @@ public:
    */
   void AddVariable(const std::string& channel);
 
+  /**
+   * @brief Add variable with the given channel and configuration. Will throw if such channel
+   * already exists.
+   *
+   * @param channel EPICS channel name.
+   * @param config Configuration of the variable.
+   */
+  void AddVariable(const std::string& channel, const PvAccessClientPVConfig& config);
+
   /**
    * @brief Returns the names of all managed channels.
    *
@@ -94,6 +113,32 @@ public:
    */
   sup::dto::AnyValue GetValue(const std::string& channel) const;
 
+  /**
+   * @brief Read the value of a channel with a one-shot get operation. The channel does not need
+   * to be added as a variable and no subscription is kept afterwards.
+   *
+   * @param channel EPICS channel name.
+   * @param timeout_sec Timeout in seconds to wait for the reply.
+   * @param fields Comma separated list of the fields to read (e.g. "value,timeStamp"), as in
+   * PvAccessClientPVConfig. When empty, the complete structure is read.
+   * @return Channel's value if successful, empty value otherwise.
+   */
+  sup::dto::AnyValue Get(const std::string& channel, double timeout_sec,
+                         const std::string& fields = {}) const;
+
+  /**
+   * @brief Read the values of multiple channels with one-shot get operations. All gets are issued
+   * before waiting for any of the replies.
+   *
+   * @param channels EPICS channel names.
+   * @param timeout_sec Timeout in seconds to wait for all replies.
+   * @return Map of channel names to their values. Channels that could not be read within the
+   * timeout period have an empty value.
+   */
+  std::map<std::string, sup::dto::AnyValue> GetMany(const std::vector<std::string>& channels,
+                                                    double timeout_sec,
+                                                    const std::string& fields = {}) const;
+
     /**
    * @brief Retrieve extended information on the variable.
    *
@@ -112,6 +157,31 @@ public:
    */
   bool SetValue(const std::string& channel, const sup::dto::AnyValue& value);
 
+  /**
+   * @brief Propagate values to multiple channels. All puts are issued before waiting for any of
+   * the replies. Will throw if one of the channels was not added yet or if one of the values is a
+   * scalar, before issuing any put.
+   *
+   * @param values Map of channel names to the values to be written.
+   * @param timeout_sec Timeout in seconds to wait for all replies.
+   * @return True if all puts succeeded within the timeout period, false otherwise. When one of the
+   * channels is unconnected or one of the values cannot be converted, no put is issued. Puts that
+   * did not complete within the timeout period are cancelled.
+   */
+  bool SetValues(const std::map<std::string, sup::dto::AnyValue>& values, double timeout_sec);
+
+  /**
+   * @brief Propagate the value of a single field to a specific channel. Only this field is sent.
+   * Will throw if channel was not added yet.
+   *
+   * @param channel EPICS channel name.
+   * @param path Path of the field in the channel's structure, e.g. "a.b.c".
+   * @param value Value to be written to the field.
+   * @return True if successful, false otherwise.
+   */
+  bool SetField(const std::string& channel, const std::string& path,
+                const sup::dto::AnyValue& value);
+
   /**
    * @brief This method waits for a specific channel to be connected with a timeout.
    *
@@ -0,0 +1,85 @@
+/******************************************************************************
+ *
+ * Project       : Supervision and automation system EPICS interface
+ *
+ * Description   : Library of SUP components for EPICS network protocol
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_EPICS_PV_ACCESS_CLIENT_CONTEXT_H_
+#define SUP_EPICS_PV_ACCESS_CLIENT_CONTEXT_H_
+
+#include <sup/dto/basic_scalar_types.h>
+
+#include <string>
+#include <vector>
+
+namespace sup
+{
+namespace epics
+{
+/**
+ * @brief Configuration of a named PvAccess client context.
+ *
+ * @details Each client context has its own worker thread, search engine and TCP connections.
+ * Assigning different traffic classes (e.g. high rate waveforms and latency critical control
+ * variables) to different contexts therefore isolates them from each other. Fields that are
+ * left empty or zero are taken from the EPICS_PVA_* environment variables:
+ * - address_list: list of addresses to search for channels. When not empty, it replaces the
+ *   address list of the environment and auto_address_list determines if the broadcast addresses of
+ *   the local interfaces are added;
+ * - name_servers: list of servers to search for channels over TCP;
+ * - udp_port: UDP port used for searching;
+ * - tcp_timeout: timeout in seconds of inactive TCP connections.
+ */
+struct PvAccessClientContextConfig
+{
+  std::vector<std::string> address_list;
+  bool auto_address_list;
+  std::vector<std::string> name_servers;
+  sup::dto::uint16 udp_port;
+  double tcp_timeout;
+};
+
+/**
+ * @brief Retrieve the default configuration of a named client context, i.e. a configuration that
+ * only uses the environment.
+ */
+PvAccessClientContextConfig GetDefaultClientContextConfig();
+
+/**
+ * @brief Create a named client context with the given configuration. Clients are assigned to
+ * this context by passing its name in their configuration. Will throw if a context with this
+ * name already exists or if the name is empty (the name of the shared default context).
+ *
+ * @param name Name of the context.
+ * @param config Configuration of the context.
+ */
+void CreatePvAccessClientContext(const std::string& name,
+                                 const PvAccessClientContextConfig& config);
+
+/**
+ * @brief Check if a named client context exists.
+ *
+ * @param name Name of the context.
+ * @return True if the context exists or if the name is empty, false otherwise.
+ */
+bool HasPvAccessClientContext(const std::string& name);
+
+}  // namespace epics
+
+}  // namespace sup
+
+#endif  // SUP_EPICS_PV_ACCESS_CLIENT_CONTEXT_H_
@@ -21,9 +21,13 @@
 #ifndef SUP_EPICS_PV_CLIENT_PV_H_
 #define SUP_EPICS_PV_CLIENT_PV_H_
 
+#include <sup/epics/pv_access_array_view.h>
+#include <sup/epics/pv_access_client_pv_config.h>
+
 #include <sup/dto/anyvalue.h>
 
 #include <functional>
+#include <future>
 #include <memory>
 
 namespace sup
@@ -46,9 +50,13 @@ public:
   {
     ExtendedValue();
     bool connected;
+    sup::dto::uint64 timestamp;
+    sup::dto::int16 status;
+    sup::dto::int16 severity;
     sup::dto::AnyValue value;
   };
   using VariableChangedCallback = std::function<void(const ExtendedValue&)>;
+  using PutCompletionCallback = std::function<void(bool)>;
 
   /**
    * @brief Constructor.
@@ -62,6 +70,16 @@ public:
    */
   explicit PvAccessClientPV(const std::string& channel, VariableChangedCallback cb = {});
 
+  /**
+   * @brief Constructor with explicit configuration.
+   *
+   * @param channel EPICS channel name.
+   * @param config Configuration of the variable.
+   * @param cb Callback function to call when the variable's value or status changed.
+   */
+  PvAccessClientPV(const std::string& channel, const PvAccessClientPVConfig& config,
+                   VariableChangedCallback cb = {});
+
   /**
    * @brief Constructor.
    *
@@ -101,10 +119,27 @@ public:
     /**
    * @brief Retrieve extended information on the variable.
    *
-   * @return Structure with value and connected status.
+   * @return Structure with value, connected status, timestamp (in ns since the POSIX epoch) and
+   * alarm status and severity. The timestamp and alarm fields are decoded from the NormativeType
+   * timeStamp and alarm substructures and remain zero when the variable does not have them.
    */
   ExtendedValue GetExtendedValue() const;
 
+  /**
+   * @brief Retrieve a view on a scalar array field of the variable without copying or converting
+   * its elements.
+   *
+   * @tparam T Element type, which has to match the element type of the field exactly. Supported
+   * types are sup::dto::boolean, the signed and unsigned integer types and the floating point
+   * types.
+   * @param field Path of the array field in the variable's structure.
+   *
+   * @return View on the last received array, or an empty view when the variable is disconnected,
+   * the field does not exist or its element type differs.
+   */
+  template <typename T>
+  PvAccessArrayView<T> GetArrayView(const std::string& field = "value") const;
+
     /**
    * @brief Write the value to the EPICS PvAccess server.
    *
@@ -114,6 +149,42 @@ public:
    */
   bool SetValue(const sup::dto::AnyValue& value);
 
+  /**
+   * @brief Write the value to the EPICS PvAccess server without waiting for the server's reply.
+   *
+   * @param value Value to be written.
+   *
+   * @return Future that becomes true when the put succeeded and false when it failed or could not
+   * be issued (e.g. when disconnected or when the maximum number of outstanding puts is reached).
+   */
+  std::future<bool> SetValueAsync(const sup::dto::AnyValue& value);
+
+  /**
+   * @brief Write the value to the EPICS PvAccess server without waiting for the server's reply.
+   *
+   * @param value Value to be written.
+   * @param cb Callback that is called once with the success status of the put. May be empty when
+   * the status is not needed.
+   *
+   * @details The callback is called from a PVXS worker thread, or from the calling thread when the
+   * put could not be issued. Puts that are still outstanding when the variable is destroyed are
+   * cancelled and reported as failed.
+   */
+  void SetValueAsync(const sup::dto::AnyValue& value, PutCompletionCallback cb);
+
+  /**
+   * @brief Write a single field of the variable to the EPICS PvAccess server.
+   *
+   * @param path Path of the field in the variable's structure, e.g. "a.b.c".
+   * @param value Value to be written to the field.
+   *
+   * @return True if successful, false otherwise.
+   *
+   * @details Only the given field is marked as changed, so only this field is transmitted and
+   * other fields that may have been changed concurrently on the server are not overwritten.
+   */
+  bool SetField(const std::string& path, const sup::dto::AnyValue& value);
+
   /**
    * @brief This method waits for the variable to be connected with a timeout.
    *
@@ -141,6 +212,11 @@ bool operator==(const PvAccessClientPV::ExtendedValue& lhs, const PvAccessClient
 
 bool operator!=(const PvAccessClientPV::ExtendedValue& lhs, const PvAccessClientPV::ExtendedValue& rhs);
 
+/**
+ * @brief Retrieve the default configuration of a PvAccessClientPV.
+ */
+PvAccessClientPVConfig GetDefaultClientPVConfig();
+
 }  // namespace epics
 
 }  // namespace sup
@@ -0,0 +1,84 @@
+/******************************************************************************
+ *
+ * Project       : Supervision and automation system EPICS interface
+ *
+ * Description   : Library of SUP components for EPICS network protocol
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_EPICS_PV_ACCESS_CLIENT_PV_CONFIG_H_
+#define SUP_EPICS_PV_ACCESS_CLIENT_PV_CONFIG_H_
+
+#include <sup/dto/basic_scalar_types.h>
+
+#include <string>
+
+namespace sup
+{
+namespace epics
+{
+/**
+ * @brief Delivery mode of the monitor updates of a PvAccessClientPV.
+ *
+ * @details In conflating mode, all updates that are queued when the client is notified are merged
+ * into a single update, which is converted once and reported with a single callback. In every
+ * update mode, each queued update is converted and reported with its own callback.
+ */
+enum class PvAccessUpdateMode
+{
+  kConflate,
+  kEveryUpdate
+};
+
+/**
+ * @brief Configuration of a PvAccessClientPV.
+ *
+ * @details The put timeout (in seconds) limits the time a synchronous put waits for the server's
+ * reply. The maximum number of outstanding puts limits the asynchronous puts that are in flight for
+ * the channel at any time; zero means no limit.
+ *
+ * The remaining fields are passed in the pvRequest of the monitor:
+ * - fields: comma separated list of the fields to subscribe to (e.g. "value,timeStamp"). When
+ *   empty, the complete structure is transferred;
+ * - queue_size: size of the server's monitor queue; zero leaves the server's default;
+ * - pipeline: enable flow control, where the server only sends as many updates as the client
+ *   acknowledged.
+ * Puts through a variable with a field selection only write the selected fields and leave the
+ * other fields of the channel unchanged.
+ *
+ * The context name selects a named client context (see CreatePvAccessClientContext); when empty,
+ * the process wide shared context is used.
+ *
+ * When strip_metadata is set, the NormativeType alarm and timeStamp substructures are removed from
+ * the variable's value. They are still decoded into the timestamp, status and severity fields of
+ * the extended value. Puts through such a variable leave the alarm and timeStamp fields unchanged.
+ */
+struct PvAccessClientPVConfig
+{
+  PvAccessUpdateMode update_mode;
+  double put_timeout;
+  sup::dto::uint32 max_outstanding_puts;
+  std::string fields;
+  sup::dto::uint32 queue_size;
+  bool pipeline;
+  std::string context_name;
+  bool strip_metadata;
+};
+
+}  // namespace epics
+
+}  // namespace sup
+
+#endif  // SUP_EPICS_PV_ACCESS_CLIENT_PV_CONFIG_H_
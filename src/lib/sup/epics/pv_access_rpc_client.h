@@ -24,7 +24,10 @@
 #include "pv_access_rpc_client_config.h"
 
 #include <sup/dto/any_functor.h>
+#include <sup/dto/anyvalue.h>
 
+#include <functional>
+#include <future>
 #include <memory>
 
 namespace sup
@@ -44,6 +47,8 @@ class PvAccessRPCClientImpl;
 class PvAccessRPCClient : public sup::dto::AnyFunctor
 {
 public:
+  using ReplyCallback = std::function<void(const sup::dto::AnyValue&)>;
+
   explicit PvAccessRPCClient(const PvAccessRPCClientConfig& config);
 
   explicit PvAccessRPCClient(std::unique_ptr<PvAccessRPCClientImpl>&& impl);
@@ -57,6 +62,44 @@ public:
   PvAccessRPCClient& operator=(const PvAccessRPCClient&) = delete;
 
   sup::dto::AnyValue operator()(const sup::dto::AnyValue& input) override;
+
+  /**
+   * @brief Send a request to the server without waiting for its reply. The client's configured
+   * timeout is used.
+   *
+   * @param input Request to send.
+   *
+   * @return Future that becomes ready with the reply, or with an error reply as for operator().
+   */
+  std::future<sup::dto::AnyValue> CallAsync(const sup::dto::AnyValue& input);
+
+  /**
+   * @brief Send a request to the server without waiting for its reply.
+   *
+   * @param input Request to send.
+   * @param timeout Timeout of this call in seconds.
+   *
+   * @return Future that becomes ready with the reply, or with an error reply as for operator().
+   */
+  std::future<sup::dto::AnyValue> CallAsync(const sup::dto::AnyValue& input, double timeout);
+
+  /**
+   * @brief Send a request to the server without waiting for its reply.
+   *
+   * @param input Request to send.
+   * @param timeout Timeout of this call in seconds.
+   * @param cb Callback that is called once with the reply. May be empty.
+   *
+   * @details Any number of calls can be in flight at the same time over the client's channel.
+   * The callback is called from a PVXS worker thread, from the thread that replies timed out calls
+   * of all clients, or from the calling thread when the request could not be sent. A call that
+   * timed out is cancelled and answered with a NotConnected error reply, as are the calls that are
+   * still in flight when the client is destroyed. A slow callback delays the replies of other calls
+   * that time out, or that complete in the same PVXS worker thread. The client must not be
+   * destroyed from one of its callbacks.
+   */
+  void CallAsync(const sup::dto::AnyValue& input, double timeout, ReplyCallback cb);
+
 private:
   std::unique_ptr<PvAccessRPCClientImpl> m_impl;
 };
@@ -31,6 +31,7 @@ struct PvAccessRPCClientConfig
 {
   std::string service_name;
   double timeout;
+  std::string context_name;
 };
 
 }  // namespace epics
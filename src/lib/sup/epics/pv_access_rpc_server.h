@@ -27,6 +27,7 @@
 
 #include <sup/dto/any_functor.h>
 #include <sup/protocol/protocol_factory.h>
+#include <sup/protocol/protocol_result.h>
 
 #include <memory>
 
@@ -36,6 +37,12 @@ namespace epics
 {
 class PvAccessRPCServerImpl;
 
+/**
+ * @brief Result of the reply to requests that are rejected by the admission control of a
+ * PvAccessRPCServer.
+ */
+const sup::protocol::ProtocolResult ServerBusy{100};
+
 /** @brief PvAccess based implementation of an RPC server
  *
  * @details This PvAccess based implementation of an RPC server forwards requests to an AnyFunctor
@@ -59,6 +66,12 @@ public:
 
   PvAccessRPCClient CreateClient(const PvAccessRPCClientConfig& config);
 
+  /**
+   * @brief Retrieve the number of accepted requests and of requests that were rejected by
+   * admission control.
+   */
+  PvAccessRPCServerCounters GetCounters() const;
+
 private:
   std::unique_ptr<PvAccessRPCServerImpl> m_impl;
 };
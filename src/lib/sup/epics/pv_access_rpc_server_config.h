@@ -21,15 +21,45 @@
 #ifndef SUP_EPICS_PV_ACCESS_RPC_SERVER_CONFIG_H_
 #define SUP_EPICS_PV_ACCESS_RPC_SERVER_CONFIG_H_
 
+#include <sup/dto/basic_scalar_types.h>
+
 #include <string>
 
 namespace sup
 {
 namespace epics
 {
+/**
+ * @brief Configuration of a PvAccessRPCServer.
+ *
+ * @details When the number of handler threads is zero, requests are handled synchronously in the
+ * PVXS worker thread that received them, so a slow request delays all other requests. Otherwise,
+ * requests are dispatched to a pool with the given number of threads, which is also the maximum
+ * number of requests that are handled concurrently. The handler then has to be thread safe when
+ * more than one thread is used.
+ *
+ * Admission control limits the load of the server: requests that exceed one of the limits are
+ * rejected immediately with the ServerBusy result instead of being queued:
+ * - max_pending_requests: maximum number of requests that wait for a free handler thread. Only
+ *   used with handler threads;
+ * - max_in_flight_requests: maximum number of requests that were accepted and not replied yet.
+ * A limit of zero means no limit.
+ */
 struct PvAccessRPCServerConfig
 {
   std::string service_name;
+  sup::dto::uint32 handler_threads;
+  sup::dto::uint32 max_pending_requests;
+  sup::dto::uint32 max_in_flight_requests;
+};
+
+/**
+ * @brief Counters of the requests received by a PvAccessRPCServer.
+ */
+struct PvAccessRPCServerCounters
+{
+  sup::dto::uint64 accepted;
+  sup::dto::uint64 rejected;
 };
 
 }  // namespace epics
@@ -22,9 +22,12 @@
 #define SUP_EPICS_PV_ACCESS_SERVER_H_
 
 #include <sup/dto/anyvalue.h>
+#include <sup/epics/pv_access_array_view.h>
 #include <sup/epics/pv_access_client.h>
+#include <sup/epics/pv_access_server_pv_config.h>
 
 #include <functional>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -76,10 +79,36 @@ public:
    * @param any_value Initial value.
    *
    * @note The type of the underlying PVA record will be deduced from the AnyValue type.
-   * It will throw if such a channel already exists.
+   * It will throw if such a channel already exists. When the server was already started, the
+   * variable is published immediately, without affecting the other variables.
    */
   void AddVariable(const std::string& channel, const sup::dto::AnyValue& any_value);
 
+  /**
+   * @brief Add variable to the server with given channel name, initial value and configuration.
+   *
+   * @param channel EPICS channel name.
+   * @param any_value Initial value.
+   * @param config Configuration of the variable.
+   *
+   * @note See AddVariable(channel, any_value).
+   */
+  void AddVariable(const std::string& channel, const sup::dto::AnyValue& any_value,
+                   const PvAccessServerPVConfig& config);
+
+  /**
+   * @brief Remove variable with given channel name from the server. Will throw if the channel was
+   * not added.
+   *
+   * @param channel EPICS channel name.
+   *
+   * @note When the server was already started, the variable's clients are disconnected. Clients of
+   * other variables are not affected. Variables can be added and removed while other threads access
+   * the server's variables; a variable that is removed during such an access stays valid until the
+   * access is finished.
+   */
+  void RemoveVariable(const std::string& channel);
+
   /**
    * @brief Returns the names of all managed channels.
    *
@@ -106,6 +135,55 @@ public:
    */
   bool SetValue(const std::string& channel, const sup::dto::AnyValue& value);
 
+  /**
+   * @brief Propagate values to multiple channels as a group. All values are converted before any
+   * of them is published, so that either all or none of the channels are changed. The updates are
+   * then posted back to back. Will throw if one of the channels was not added yet or if one of the
+   * values cannot be converted to its channel's type.
+   *
+   * @param values Map of channel names to the values to be written.
+   *
+   * @return True if successful, false otherwise.
+   *
+   * @note Each channel is still monitored separately by clients, so clients may observe the
+   * updates of different channels at slightly different times. Group updates are only serialized
+   * against each other: single SetValue or SetArray calls, client puts and the deferred posts of
+   * rate limited variables can interleave with the posts of a group.
+   */
+  bool SetValues(const std::map<std::string, sup::dto::AnyValue>& values);
+
+  /**
+   * @brief Publish a scalar array field of a specific channel without copying its elements. Will
+   * throw if the channel was not added yet or if the field is not a scalar array with the same
+   * element type and number of elements.
+   *
+   * @tparam T Element type, which has to match the element type of the field exactly. Supported
+   * types are sup::dto::boolean, the signed and unsigned integer types and the floating point
+   * types.
+   * @param channel EPICS channel name.
+   * @param array Array to publish. Its buffer is shared with the channel and must not be modified
+   * afterwards.
+   * @param field Path of the array field in the channel's structure.
+   *
+   * @return True if successful, false otherwise.
+   *
+   * @details Only the array field is posted to the clients. The channel's AnyValue is only updated
+   * from the shared buffer when it is needed, e.g. by GetValue or the server's callback.
+   */
+  template <typename T>
+  bool SetArray(const std::string& channel, const PvAccessArrayView<T>& array,
+                const std::string& field = "value");
+
+  /**
+   * @brief Get the counters of posted and dropped updates of a specific channel. Updates are only
+   * dropped when the channel's post rate is limited. Will throw if the channel was not added yet.
+   *
+   * @param channel EPICS channel name.
+   *
+   * @return Channel's post counters.
+   */
+  PvAccessPostCounters GetPostCounters(const std::string& channel) const;
+
   /**
    * @brief Starts PvAccess server and publishes all added variables.
    */
@@ -135,6 +213,11 @@ private:
   std::unique_ptr<PvAccessServerImpl> p_impl;
 };
 
+/**
+ * @brief Retrieve the default configuration of a PvAccess server variable, without rate limiting.
+ */
+PvAccessServerPVConfig GetDefaultServerPVConfig();
+
 }  // namespace epics
 
 }  // namespace sup
@@ -0,0 +1,59 @@
+/******************************************************************************
+ *
+ * Project       : Supervision and automation system EPICS interface
+ *
+ * Description   : Library of SUP components for EPICS network protocol
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_EPICS_PV_ACCESS_SERVER_PV_CONFIG_H_
+#define SUP_EPICS_PV_ACCESS_SERVER_PV_CONFIG_H_
+
+#include <sup/dto/basic_scalar_types.h>
+
+namespace sup
+{
+namespace epics
+{
+/**
+ * @brief Configuration of a PvAccess server variable.
+ *
+ * @details The maximum post rate (in Hz) limits how often value updates are posted to the
+ * variable's clients. Updates that arrive faster are conflated: only the latest value is posted
+ * when the rate allows it again, while the variable's value itself is always up to date. This
+ * includes the updates written by client puts. A rate of zero disables rate limiting.
+ */
+struct PvAccessServerPVConfig
+{
+  double max_post_rate;
+};
+
+/**
+ * @brief Counters of the value updates of a PvAccess server variable.
+ *
+ * @details Updates are either posted to the clients or dropped, when a newer value replaced them
+ * before the post rate allowed them to be posted.
+ */
+struct PvAccessPostCounters
+{
+  sup::dto::uint64 posted;
+  sup::dto::uint64 dropped;
+};
+
+}  // namespace epics
+
+}  // namespace sup
+
+#endif  // SUP_EPICS_PV_ACCESS_SERVER_PV_CONFIG_H_
@@ -30,6 +30,11 @@ PvAccessClient::PvAccessClient(VariableChangedCallback cb)
   : m_impl{std::make_unique<PvAccessClientImpl>(utils::GetSharedClientContext(), std::move(cb))}
 {}
 
+PvAccessClient::PvAccessClient(const std::string& context_name, VariableChangedCallback cb)
+  : m_impl{std::make_unique<PvAccessClientImpl>(utils::GetClientContext(context_name),
+                                                std::move(cb))}
+{}
+
 PvAccessClient::PvAccessClient(std::unique_ptr<PvAccessClientImpl>&& impl)
   : m_impl{std::move(impl)}
 {}
@@ -51,7 +56,12 @@ PvAccessClient& PvAccessClient::operator=(PvAccessClient&& other) noexcept
 
 void PvAccessClient::AddVariable(const std::string& channel)
 {
-  m_impl->AddVariable(channel);
+  m_impl->AddVariable(channel, GetDefaultClientPVConfig());
+}
+
+void PvAccessClient::AddVariable(const std::string& channel, const PvAccessClientPVConfig& config)
+{
+  m_impl->AddVariable(channel, config);
 }
 
 std::vector<std::string> PvAccessClient::GetVariableNames() const
@@ -77,6 +87,18 @@ dto::AnyValue PvAccessClient::GetValue(const std::string& channel) const
   return it->second->GetValue();
 }
 
+dto::AnyValue PvAccessClient::Get(const std::string& channel, double timeout_sec,
+                                  const std::string& fields) const
+{
+  return m_impl->GetMany({channel}, timeout_sec, fields)[channel];
+}
+
+std::map<std::string, sup::dto::AnyValue> PvAccessClient::GetMany(
+  const std::vector<std::string>& channels, double timeout_sec, const std::string& fields) const
+{
+  return m_impl->GetMany(channels, timeout_sec, fields);
+}
+
 PvAccessClientPV::ExtendedValue PvAccessClient::GetExtendedValue(const std::string& channel) const
 {
   auto& var_map = m_impl->GetVariables();
@@ -100,6 +122,25 @@ bool PvAccessClient::SetValue(const std::string& channel, const dto::AnyValue& v
   return it->second->SetValue(value);
 }
 
+bool PvAccessClient::SetValues(const std::map<std::string, sup::dto::AnyValue>& values,
+                               double timeout_sec)
+{
+  return m_impl->SetValues(values, timeout_sec);
+}
+
+bool PvAccessClient::SetField(const std::string& channel, const std::string& path,
+                              const sup::dto::AnyValue& value)
+{
+  auto& var_map = m_impl->GetVariables();
+  auto it = var_map.find(channel);
+  if (it == var_map.end())
+  {
+    throw std::runtime_error("Error in PvAccessClient: non-existing variable name '" +
+                             channel + "'.");
+  }
+  return it->second->SetField(path, value);
+}
+
 bool PvAccessClient::WaitForConnected(const std::string& channel, double timeout_sec) const
 {
   auto& var_map = m_impl->GetVariables();
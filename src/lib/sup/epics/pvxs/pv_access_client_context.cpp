@@ -0,0 +1,70 @@
+/******************************************************************************
+ *
+ * Project       : Supervision and automation system EPICS interface
+ *
+ * Description   : Library of SUP components for EPICS network protocol
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include <sup/epics/pv_access_client_context.h>
+
+#include "pv_access_utils.h"
+
+namespace sup
+{
+namespace epics
+{
+
+PvAccessClientContextConfig GetDefaultClientContextConfig()
+{
+  PvAccessClientContextConfig result;
+  result.auto_address_list = true;
+  result.udp_port = 0;
+  result.tcp_timeout = 0.0;
+  return result;
+}
+
+void CreatePvAccessClientContext(const std::string& name,
+                                 const PvAccessClientContextConfig& config)
+{
+  auto pvxs_config = pvxs::client::Config::fromEnv();
+  if (!config.address_list.empty())
+  {
+    pvxs_config.addressList = config.address_list;
+    pvxs_config.autoAddrList = config.auto_address_list;
+  }
+  if (!config.name_servers.empty())
+  {
+    pvxs_config.nameServers = config.name_servers;
+  }
+  if (config.udp_port > 0)
+  {
+    pvxs_config.udp_port = config.udp_port;
+  }
+  if (config.tcp_timeout > 0.0)
+  {
+    pvxs_config.tcpTimeout = config.tcp_timeout;
+  }
+  utils::RegisterClientContext(name, std::make_shared<pvxs::client::Context>(pvxs_config.build()));
+}
+
+bool HasPvAccessClientContext(const std::string& name)
+{
+  return utils::HasClientContext(name);
+}
+
+}  // namespace epics
+
+}  // namespace sup
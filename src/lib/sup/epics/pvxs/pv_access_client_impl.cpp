@@ -21,6 +21,15 @@
 #include "pv_access_client_impl.h"
 
 #include "pv_access_client_pv_impl.h"
+#include "pv_access_utils.h"
+
+#include <sup/epics/utils/dto_conversion_utils.h>
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <future>
+#include <utility>
 
 namespace sup
 {
@@ -32,12 +41,14 @@ PvAccessClientImpl::PvAccessClientImpl(std::shared_ptr<pvxs::client::Context> co
   : m_cb{cb}
   , m_context{context}
   , m_variables{}
+  , m_variable_impls{}
 {}
 
 PvAccessClientImpl::~PvAccessClientImpl() = default;
 
 //! Adds channel with given name to the map of channels.
-void PvAccessClientImpl::AddVariable(const std::string& channel)
+void PvAccessClientImpl::AddVariable(const std::string& channel,
+                                     const PvAccessClientPVConfig& config)
 {
   auto iter = m_variables.find(channel);
   if (iter != m_variables.end())
@@ -48,7 +59,11 @@ void PvAccessClientImpl::AddVariable(const std::string& channel)
   auto cb = [this, channel](const PvAccessClientPV::ExtendedValue& value) {
       OnVariableChanged(channel, value);
   };
-  auto pv_impl = std::make_unique<sup::epics::PvAccessClientPVImpl>(channel, m_context, cb);
+  auto context =
+    config.context_name.empty() ? m_context : utils::GetClientContext(config.context_name);
+  auto pv_impl =
+    std::make_unique<sup::epics::PvAccessClientPVImpl>(channel, context, cb, config);
+  m_variable_impls[channel] = pv_impl.get();
   (void)m_variables.emplace(channel, std::make_unique<sup::epics::PvAccessClientPV>(std::move(pv_impl)));
 }
 
@@ -65,6 +80,96 @@ const std::map<std::string, std::unique_ptr<PvAccessClientPV>>& PvAccessClientIm
   return m_variables;
 }
 
+//! Builds the puts for all channels before issuing any of them, so that invalid values fail the
+//! batch without writing anything. Puts that did not complete before the timeout are cancelled.
+bool PvAccessClientImpl::SetValues(const std::map<std::string, sup::dto::AnyValue>& values,
+                                   double timeout_sec)
+{
+  std::vector<std::pair<PvAccessClientPVImpl*, pvxs::Value>> puts;
+  for (const auto& channel_value : values)
+  {
+    auto it = m_variable_impls.find(channel_value.first);
+    if (it == m_variable_impls.end())
+    {
+      throw std::runtime_error("Error in PvAccessClient: non-existing variable name '" +
+                               channel_value.first + "'.");
+    }
+    puts.emplace_back(it->second, pvxs::Value{});
+  }
+  bool success = true;
+  auto value_it = values.begin();
+  for (auto& put : puts)
+  {
+    if (!put.first->BuildPutValue((value_it++)->second, put.second))
+    {
+      success = false;
+    }
+  }
+  if (!success)
+  {
+    return false;
+  }
+  std::vector<sup::dto::uint64> put_ids;
+  std::vector<std::future<bool>> results;
+  for (const auto& put : puts)
+  {
+    auto promise = std::make_shared<std::promise<bool>>();
+    results.push_back(promise->get_future());
+    put_ids.push_back(
+      put.first->IssuePut(put.second, [promise](bool ok) { promise->set_value(ok); }));
+  }
+  auto timeout = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+    std::chrono::duration<double>(timeout_sec));
+  auto deadline = std::chrono::steady_clock::now() + timeout;
+  for (std::size_t idx = 0; idx < puts.size(); ++idx)
+  {
+    if (results[idx].wait_until(deadline) != std::future_status::ready
+        && puts[idx].first->CancelPut(put_ids[idx]))
+    {
+      success = false;
+    }
+    else if (!results[idx].get())
+    {
+      success = false;
+    }
+  }
+  return success;
+}
+
+//! Issues a get operation for all channels before waiting for their results. Channels that fail
+//! or do not reply before the timeout get an empty value.
+std::map<std::string, sup::dto::AnyValue> PvAccessClientImpl::GetMany(
+  const std::vector<std::string>& channels, double timeout_sec, const std::string& fields) const
+{
+  auto field_selection = utils::GetFieldSelection(fields);
+  std::vector<std::shared_ptr<pvxs::client::Operation>> operations;
+  for (const auto& channel : channels)
+  {
+    auto builder = m_context->get(channel);
+    for (const auto& field : field_selection)
+    {
+      (void)builder.field(field);
+    }
+    operations.push_back(builder.exec());
+  }
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::duration<double>(timeout_sec);
+  std::map<std::string, sup::dto::AnyValue> result;
+  for (std::size_t idx = 0; idx < channels.size(); ++idx)
+  {
+    auto& value = result[channels[idx]];
+    std::chrono::duration<double> remaining = deadline - std::chrono::steady_clock::now();
+    try
+    {
+      value = BuildAnyValue(operations[idx]->wait(std::max(remaining.count(), 0.0)));
+    }
+    catch (const std::exception& ex)
+    {
+      value = sup::dto::AnyValue{};
+    }
+  }
+  return result;
+}
+
 void PvAccessClientImpl::OnVariableChanged(const std::string& channel,
                                            const PvAccessClientPV::ExtendedValue& value)
 {
@@ -35,6 +35,7 @@ namespace sup
 {
 namespace epics
 {
+class PvAccessClientPVImpl;
 
 class PvAccessClientImpl
 {
@@ -49,17 +50,25 @@ public:
 
   ~PvAccessClientImpl();
 
-  void AddVariable(const std::string& channel);
+  void AddVariable(const std::string& channel, const PvAccessClientPVConfig& config);
 
   std::vector<std::string> GetVariableNames() const;
 
   const std::map<std::string, std::unique_ptr<PvAccessClientPV>>& GetVariables() const;
 
+  bool SetValues(const std::map<std::string, sup::dto::AnyValue>& values, double timeout_sec);
+
+  std::map<std::string, sup::dto::AnyValue> GetMany(const std::vector<std::string>& channels,
+                                                    double timeout_sec,
+                                                    const std::string& fields) const;
+
 private:
   void OnVariableChanged(const std::string& channel, const PvAccessClientPV::ExtendedValue& value);
   PvAccessClient::VariableChangedCallback m_cb;  // Order matters: callback should survive PVs
   std::shared_ptr<pvxs::client::Context> m_context;
   std::map<std::string, std::unique_ptr<PvAccessClientPV>> m_variables;
+  //! Implementations of the variables above, which stay in place for the lifetime of the client.
+  std::map<std::string, PvAccessClientPVImpl*> m_variable_impls;
 };
 
 }  // namespace epics
@@ -29,6 +29,9 @@ namespace epics
 
 PvAccessClientPV::ExtendedValue::ExtendedValue()
   : connected{false}
+  , timestamp{0}
+  , status{0}
+  , severity{0}
   , value{}
 {}
 
@@ -36,6 +39,13 @@ PvAccessClientPV::PvAccessClientPV(const std::string& channel, VariableChangedCa
   : m_impl{std::make_unique<PvAccessClientPVImpl>(channel, utils::GetSharedClientContext(), cb)}
 {}
 
+PvAccessClientPV::PvAccessClientPV(const std::string& channel,
+                                   const PvAccessClientPVConfig& config,
+                                   VariableChangedCallback cb)
+  : m_impl{std::make_unique<PvAccessClientPVImpl>(
+      channel, utils::GetClientContext(config.context_name), cb, config)}
+{}
+
 PvAccessClientPV::PvAccessClientPV(std::unique_ptr<PvAccessClientPVImpl>&& impl)
   : m_impl{std::move(impl)}
 {}
@@ -75,11 +85,55 @@ PvAccessClientPV::ExtendedValue PvAccessClientPV::GetExtendedValue() const
   return m_impl->GetExtendedValue();
 }
 
+template <typename T>
+PvAccessArrayView<T> PvAccessClientPV::GetArrayView(const std::string& field) const
+{
+  return m_impl->GetArrayView<T>(field);
+}
+
+template PvAccessArrayView<sup::dto::boolean> PvAccessClientPV::GetArrayView(
+  const std::string&) const;
+template PvAccessArrayView<sup::dto::int8> PvAccessClientPV::GetArrayView(
+  const std::string&) const;
+template PvAccessArrayView<sup::dto::uint8> PvAccessClientPV::GetArrayView(
+  const std::string&) const;
+template PvAccessArrayView<sup::dto::int16> PvAccessClientPV::GetArrayView(
+  const std::string&) const;
+template PvAccessArrayView<sup::dto::uint16> PvAccessClientPV::GetArrayView(
+  const std::string&) const;
+template PvAccessArrayView<sup::dto::int32> PvAccessClientPV::GetArrayView(
+  const std::string&) const;
+template PvAccessArrayView<sup::dto::uint32> PvAccessClientPV::GetArrayView(
+  const std::string&) const;
+template PvAccessArrayView<sup::dto::int64> PvAccessClientPV::GetArrayView(
+  const std::string&) const;
+template PvAccessArrayView<sup::dto::uint64> PvAccessClientPV::GetArrayView(
+  const std::string&) const;
+template PvAccessArrayView<sup::dto::float32> PvAccessClientPV::GetArrayView(
+  const std::string&) const;
+template PvAccessArrayView<sup::dto::float64> PvAccessClientPV::GetArrayView(
+  const std::string&) const;
+
 bool PvAccessClientPV::SetValue(const sup::dto::AnyValue& value)
 {
   return m_impl->SetValue(value);
 }
 
+std::future<bool> PvAccessClientPV::SetValueAsync(const sup::dto::AnyValue& value)
+{
+  return m_impl->SetValueAsync(value);
+}
+
+void PvAccessClientPV::SetValueAsync(const sup::dto::AnyValue& value, PutCompletionCallback cb)
+{
+  m_impl->SetValueAsync(value, std::move(cb));
+}
+
+bool PvAccessClientPV::SetField(const std::string& path, const sup::dto::AnyValue& value)
+{
+  return m_impl->SetField(path, value);
+}
+
 bool PvAccessClientPV::WaitForConnected(double timeout_sec) const
 {
   return m_impl->WaitForConnected(timeout_sec);
@@ -92,7 +146,8 @@ bool PvAccessClientPV::WaitForValidValue(double timeout_sec) const
 
 bool operator==(const PvAccessClientPV::ExtendedValue& lhs, const PvAccessClientPV::ExtendedValue& rhs)
 {
-  return lhs.connected == rhs.connected && lhs.value == rhs.value;
+  return lhs.connected == rhs.connected && lhs.timestamp == rhs.timestamp
+         && lhs.status == rhs.status && lhs.severity == rhs.severity && lhs.value == rhs.value;
 }
 
 bool operator!=(const PvAccessClientPV::ExtendedValue& lhs, const PvAccessClientPV::ExtendedValue& rhs)
@@ -100,6 +155,20 @@ bool operator!=(const PvAccessClientPV::ExtendedValue& lhs, const PvAccessClient
   return !(lhs == rhs);
 }
 
+PvAccessClientPVConfig GetDefaultClientPVConfig()
+{
+  PvAccessClientPVConfig result;
+  result.update_mode = PvAccessUpdateMode::kConflate;
+  result.put_timeout = 2.0;
+  result.max_outstanding_puts = 0;
+  result.fields = "";
+  result.queue_size = 0;
+  result.pipeline = false;
+  result.context_name = "";
+  result.strip_metadata = false;
+  return result;
+}
+
 }  // namespace epics
 
 }  // namespace sup
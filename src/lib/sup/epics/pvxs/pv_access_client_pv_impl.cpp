@@ -19,8 +19,10 @@
  *****************************************************************************/
 
 #include "pv_access_client_pv_impl.h"
+#include "pv_access_utils.h"
 
 #include <sup/epics/utils/dto_conversion_utils.h>
+#include <sup/epics/utils/pvxs_utils.h>
 
 #include <sup/dto/anyvalue_helper.h>
 
@@ -28,6 +30,20 @@
 
 #include <chrono>
 #include <cmath>
+#include <exception>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace
+{
+const std::string kAlarmField = "alarm";
+const std::string kTimeStampField = "timeStamp";
+
+sup::dto::AnyValue StripMetadata(const sup::dto::AnyValue& value);
+
+pvxs::Value ApplyToPrototype(const pvxs::Value& pvxs_value, pvxs::Value&& proto);
+}  // unnamed namespace
 
 namespace sup
 {
@@ -35,31 +51,53 @@ namespace epics
 {
 
 PvAccessClientPVImpl::PvAccessClientPVImpl(const std::string& channel,
-  std::shared_ptr<pvxs::client::Context> context, PvAccessClientPV::VariableChangedCallback cb)
+  std::shared_ptr<pvxs::client::Context> context, PvAccessClientPV::VariableChangedCallback cb,
+  const PvAccessClientPVConfig& config)
   : m_channel_name{channel}
+  , m_config{config}
   , m_context{std::move(context)}
   , m_changed_cb{std::move(cb)}
   , m_cache{}
+  , m_conversion_plan{}
+  , m_pvxs_cache{}
+  , m_metadata_fields{}
   , m_mon_mtx{}
   , m_cv{}
   , m_subscription{}
-  , m_max_put_timeout{2.0}
+  , m_put_mtx{}
+  , m_puts{}
+  , m_next_put_id{1}
 {
   if (!m_context)
   {
     throw std::runtime_error("Constructing PvAccessClientPVImpl without context.");
   }
-  m_subscription = m_context->monitor(m_channel_name)
-                              .maskConnected(false)
-                              .maskDisconnected(false)
-                              .event([this](pvxs::client::Subscription& sup)
-                                     {
-                                       ProcessMonitor(sup);
-                                     })
-                              .exec();
+  auto builder = m_context->monitor(m_channel_name);
+  for (const auto& field : utils::GetFieldSelection(m_config.fields))
+  {
+    (void)builder.field(field);
+  }
+  if (m_config.queue_size > 0)
+  {
+    (void)builder.record("queueSize", m_config.queue_size);
+  }
+  if (m_config.pipeline)
+  {
+    (void)builder.record("pipeline", true);
+  }
+  m_subscription = builder.maskConnected(false)
+                          .maskDisconnected(false)
+                          .event([this](pvxs::client::Subscription& sup)
+                                 {
+                                   ProcessMonitor(sup);
+                                 })
+                          .exec();
 }
 
-PvAccessClientPVImpl::~PvAccessClientPVImpl() = default;
+PvAccessClientPVImpl::~PvAccessClientPVImpl()
+{
+  CancelPuts();
+}
 
 bool PvAccessClientPVImpl::IsConnected() const
 {
@@ -88,7 +126,82 @@ PvAccessClientPV::ExtendedValue PvAccessClientPVImpl::GetExtendedValue() const
   return m_cache;
 }
 
+template <typename T>
+PvAccessArrayView<T> PvAccessClientPVImpl::GetArrayView(const std::string& field) const
+{
+  std::lock_guard<std::mutex> lk(m_mon_mtx);
+  if (!m_cache.connected || !m_pvxs_cache.valid())
+  {
+    return {};
+  }
+  auto array_field = m_pvxs_cache[field];
+  if (array_field.type() != utils::ArrayTypeCode<T>())
+  {
+    return {};
+  }
+  // The element types match, so no conversion or copy takes place.
+  auto array = array_field.template as<pvxs::shared_array<const T>>();
+  return PvAccessArrayView<T>(array.dataPtr(), array.size());
+}
+
+template PvAccessArrayView<sup::dto::boolean> PvAccessClientPVImpl::GetArrayView(
+  const std::string&) const;
+template PvAccessArrayView<sup::dto::int8> PvAccessClientPVImpl::GetArrayView(
+  const std::string&) const;
+template PvAccessArrayView<sup::dto::uint8> PvAccessClientPVImpl::GetArrayView(
+  const std::string&) const;
+template PvAccessArrayView<sup::dto::int16> PvAccessClientPVImpl::GetArrayView(
+  const std::string&) const;
+template PvAccessArrayView<sup::dto::uint16> PvAccessClientPVImpl::GetArrayView(
+  const std::string&) const;
+template PvAccessArrayView<sup::dto::int32> PvAccessClientPVImpl::GetArrayView(
+  const std::string&) const;
+template PvAccessArrayView<sup::dto::uint32> PvAccessClientPVImpl::GetArrayView(
+  const std::string&) const;
+template PvAccessArrayView<sup::dto::int64> PvAccessClientPVImpl::GetArrayView(
+  const std::string&) const;
+template PvAccessArrayView<sup::dto::uint64> PvAccessClientPVImpl::GetArrayView(
+  const std::string&) const;
+template PvAccessArrayView<sup::dto::float32> PvAccessClientPVImpl::GetArrayView(
+  const std::string&) const;
+template PvAccessArrayView<sup::dto::float64> PvAccessClientPVImpl::GetArrayView(
+  const std::string&) const;
+
 bool PvAccessClientPVImpl::SetValue(const sup::dto::AnyValue& value)
+{
+  pvxs::Value pvxs_value;
+  if (!BuildPutValue(value, pvxs_value))
+  {
+    return false;
+  }
+  return PutAndWait(pvxs_value);
+}
+
+std::future<bool> PvAccessClientPVImpl::SetValueAsync(const sup::dto::AnyValue& value)
+{
+  auto promise = std::make_shared<std::promise<bool>>();
+  auto result = promise->get_future();
+  SetValueAsync(value, [promise](bool success) { promise->set_value(success); });
+  return result;
+}
+
+void PvAccessClientPVImpl::SetValueAsync(const sup::dto::AnyValue& value,
+                                         PvAccessClientPV::PutCompletionCallback cb)
+{
+  if (!cb)
+  {
+    cb = [](bool) {};
+  }
+  pvxs::Value pvxs_value;
+  if (!BuildPutValue(value, pvxs_value))
+  {
+    cb(false);
+    return;
+  }
+  (void)IssuePut(pvxs_value, std::move(cb));
+}
+
+bool PvAccessClientPVImpl::SetField(const std::string& path, const sup::dto::AnyValue& value)
 {
   sup::dto::AnyValue copy;
   {
@@ -99,34 +212,101 @@ bool PvAccessClientPVImpl::SetValue(const sup::dto::AnyValue& value)
     }
     copy = m_cache.value;
   }
-  if (sup::dto::IsScalarValue(value))
+  if (!copy.HasField(path) || !sup::dto::TryAssignIfEmptyOrConvert(copy[path], value))
   {
-    throw std::runtime_error("Error in PvAccessClientPV: cannot set a scalar value");
+    return false;
   }
-  if (!sup::dto::TryAssignIfEmptyOrConvert(copy, value))
+  auto pvxs_value = sup::epics::BuildPVXSValue(copy);
+  // Only the touched field is marked, which covers all its members, so only that part is sent.
+  auto field = pvxs_value[path];
+  if (sup::epics::IsEmptyValue(field))
   {
     return false;
   }
-  auto pvxs_value = sup::epics::BuildPVXSValue(copy);
+  (void)pvxs_value.unmark(false, true);
+  field.mark();
+  return PutAndWait(pvxs_value);
+}
 
-  auto operation = m_context->put(m_channel_name)
-                    .build([pvxs_value](pvxs::Value&& /*proto*/) { return pvxs_value; })
-                    .exec();
-  try
+bool PvAccessClientPVImpl::BuildPutValue(const sup::dto::AnyValue& value,
+                                         pvxs::Value& pvxs_value) const
+{
+  sup::dto::AnyValue copy;
   {
-    (void)operation->wait(m_max_put_timeout);
+    std::lock_guard<std::mutex> lk(m_mon_mtx);
+    if (!m_cache.connected)
+    {
+      return false;
+    }
+    copy = m_cache.value;
   }
-  catch (const pvxs::client::Timeout& ex)
+  if (sup::dto::IsScalarValue(value))
   {
-    return false;
+    throw std::runtime_error("Error in PvAccessClientPV: cannot set a scalar value");
   }
-  catch (const pvxs::client::Interrupted& ex)
+  if (!sup::dto::TryAssignIfEmptyOrConvert(copy, value))
   {
     return false;
   }
+  pvxs_value = sup::epics::BuildPVXSValue(copy);
+  pvxs_value.mark();
   return true;
 }
 
+sup::dto::uint64 PvAccessClientPVImpl::IssuePut(const pvxs::Value& pvxs_value,
+                                                PvAccessClientPV::PutCompletionCallback cb)
+{
+  {
+    std::lock_guard<std::mutex> lk(m_put_mtx);
+    // Operations of completed puts are only released here, never from their own result callback.
+    for (auto it = m_puts.begin(); it != m_puts.end();)
+    {
+      it = it->second.completed ? m_puts.erase(it) : std::next(it);
+    }
+    if (m_config.max_outstanding_puts == 0 || m_puts.size() < m_config.max_outstanding_puts)
+    {
+      auto put_id = m_next_put_id++;
+      auto& pending = m_puts[put_id];
+      pending.callback = std::move(cb);
+      pending.completed = false;
+      pending.operation =
+        m_context->put(m_channel_name)
+          .build([pvxs_value](pvxs::Value&& proto)
+                 { return ApplyToPrototype(pvxs_value, std::move(proto)); })
+          .result([this, put_id](pvxs::client::Result&& result)
+                  {
+                    bool success = true;
+                    try
+                    {
+                      (void)result();
+                    }
+                    catch (const std::exception& ex)
+                    {
+                      success = false;
+                    }
+                    OnPutCompleted(put_id, success);
+                  })
+          .exec();
+      return put_id;
+    }
+  }
+  cb(false);
+  return 0;
+}
+
+bool PvAccessClientPVImpl::PutAndWait(const pvxs::Value& pvxs_value)
+{
+  auto promise = std::make_shared<std::promise<bool>>();
+  auto result = promise->get_future();
+  auto put_id = IssuePut(pvxs_value, [promise](bool success) { promise->set_value(success); });
+  auto timeout = std::chrono::duration<double>(m_config.put_timeout);
+  if (result.wait_for(timeout) != std::future_status::ready && CancelPut(put_id))
+  {
+    return false;
+  }
+  return result.get();
+}
+
 bool PvAccessClientPVImpl::WaitForConnected(double timeout_sec) const
 {
   auto duration = std::chrono::duration<double>(timeout_sec);
@@ -151,42 +331,239 @@ void PvAccessClientPVImpl::ProcessMonitor(pvxs::client::Subscription& sub)
 {
   {
     std::lock_guard<std::mutex> lk(m_mon_mtx);
-    auto result = m_cache;
+    const bool every_update = m_config.update_mode == PvAccessUpdateMode::kEveryUpdate;
+    auto notify = [this, every_update]{
+      if (every_update && m_changed_cb)
+      {
+        m_changed_cb(m_cache);
+      }
+    };
+    // In conflating mode, queued updates are merged into a single pvxs value. This pending value
+    // is applied before a connection change, so updates from different connections never mix.
+    pvxs::Value pending;
+    auto apply_pending = [this, &pending]{
+      if (pending)
+      {
+        ApplyUpdate(pending);
+        pending = pvxs::Value{};
+      }
+    };
     while (true)
     {
       try
       {
         auto update = sub.pop();
-        if (update)
+        if (!update)
         {
-          if (!sup::dto::TryAssignIfEmptyOrConvert(result.value, sup::epics::BuildAnyValue(update)))
-          {
-            throw std::runtime_error("PvAccessClientPVImpl received incompatible value update.");
-          }
+          break;
+        }
+        if (every_update)
+        {
+          ApplyUpdate(update);
+          notify();
+        }
+        else if (pending)
+        {
+          pending.assign(update);
         }
         else
         {
-          break;
+          pending = std::move(update);
         }
       }
       catch (pvxs::client::Connected& ex)
       {
-        result.connected = true;
+        apply_pending();
+        m_cache.connected = true;
+        notify();
       }
       catch (pvxs::client::Disconnect& ex)
       {
-        result.connected = false;
+        apply_pending();
+        m_cache.connected = false;
+        notify();
       }
     }
-    m_cache = result;
-    if (m_changed_cb)
+    apply_pending();
+    if (!every_update && m_changed_cb)
     {
-      m_changed_cb(result);
+      m_changed_cb(m_cache);
     }
   }
   m_cv.notify_one();
 }
 
+void PvAccessClientPVImpl::ApplyUpdate(const pvxs::Value& update)
+{
+  // Once a complete value is cached, the conversion plan compiled for it patches the changed
+  // fields in place. Otherwise, or when patching fails (e.g. the server changed the type), fall
+  // back to a full conversion and compile a new plan.
+  // The PVXS cache keeps the received arrays, which are shared and not copied, for array views.
+  if (m_conversion_plan.IsCompiled() && m_conversion_plan.Apply(update, true))
+  {
+    m_pvxs_cache.assign(update);
+    DecodeMetadata();
+    return;
+  }
+  m_conversion_plan.Reset();
+  // The full conversion is done on a copy, so the cache is only changed when it succeeds.
+  auto value = m_cache.value;
+  if (!ConvertUpdate(update, value))
+  {
+    // A failed plan may have patched part of the cache, so it is restored from the last update.
+    if (m_pvxs_cache.valid())
+    {
+      (void)ConvertUpdate(m_pvxs_cache, m_cache.value);
+    }
+    throw std::runtime_error("PvAccessClientPVImpl received incompatible value update.");
+  }
+  m_cache.value = value;
+  std::vector<std::string> skipped_fields;
+  if (m_config.strip_metadata)
+  {
+    skipped_fields = { kAlarmField, kTimeStampField };
+  }
+  (void)m_conversion_plan.Compile(update, m_cache.value, skipped_fields);
+  m_pvxs_cache = update;
+  m_metadata_fields.seconds = m_pvxs_cache[kTimeStampField + ".secondsPastEpoch"];
+  m_metadata_fields.nanoseconds = m_pvxs_cache[kTimeStampField + ".nanoseconds"];
+  m_metadata_fields.status = m_pvxs_cache[kAlarmField + ".status"];
+  m_metadata_fields.severity = m_pvxs_cache[kAlarmField + ".severity"];
+  DecodeMetadata();
+}
+
+bool PvAccessClientPVImpl::ConvertUpdate(const pvxs::Value& update,
+                                         sup::dto::AnyValue& value) const
+{
+  auto any_value = sup::epics::BuildAnyValue(update);
+  if (m_config.strip_metadata)
+  {
+    any_value = StripMetadata(any_value);
+  }
+  return sup::dto::TryAssignIfEmptyOrConvert(value, any_value);
+}
+
+//! Decodes the metadata directly from the fields of the PVXS cache, without an AnyValue conversion.
+void PvAccessClientPVImpl::DecodeMetadata()
+{
+  if (m_metadata_fields.seconds.valid() && m_metadata_fields.nanoseconds.valid())
+  {
+    m_cache.timestamp =
+      m_metadata_fields.seconds.as<sup::dto::uint64>() * 1000000000u
+      + m_metadata_fields.nanoseconds.as<sup::dto::uint64>();
+  }
+  if (m_metadata_fields.status.valid())
+  {
+    m_cache.status = m_metadata_fields.status.as<sup::dto::int16>();
+  }
+  if (m_metadata_fields.severity.valid())
+  {
+    m_cache.severity = m_metadata_fields.severity.as<sup::dto::int16>();
+  }
+}
+
+void PvAccessClientPVImpl::OnPutCompleted(sup::dto::uint64 put_id, bool success)
+{
+  PvAccessClientPV::PutCompletionCallback cb;
+  {
+    std::lock_guard<std::mutex> lk(m_put_mtx);
+    auto it = m_puts.find(put_id);
+    if (it == m_puts.end() || it->second.completed)
+    {
+      return;
+    }
+    it->second.completed = true;
+    std::swap(cb, it->second.callback);
+  }
+  cb(success);
+}
+
+bool PvAccessClientPVImpl::CancelPut(sup::dto::uint64 put_id)
+{
+  std::shared_ptr<pvxs::client::Operation> operation;
+  {
+    std::lock_guard<std::mutex> lk(m_put_mtx);
+    auto it = m_puts.find(put_id);
+    if (it == m_puts.end() || it->second.completed)
+    {
+      return false;
+    }
+    std::swap(operation, it->second.operation);
+    (void)m_puts.erase(it);
+  }
+  // Cancelling waits for a running result callback, which then no longer finds its put.
+  (void)operation->cancel();
+  return true;
+}
+
+void PvAccessClientPVImpl::CancelPuts()
+{
+  std::map<sup::dto::uint64, PendingPut> puts;
+  {
+    std::lock_guard<std::mutex> lk(m_put_mtx);
+    std::swap(puts, m_puts);
+  }
+  // Cancelling waits for a running result callback, which then no longer finds its put.
+  for (auto& put : puts)
+  {
+    if (put.second.operation)
+    {
+      (void)put.second.operation->cancel();
+    }
+  }
+  for (auto& put : puts)
+  {
+    if (!put.second.completed)
+    {
+      put.second.callback(false);
+    }
+  }
+}
+
 }  // namespace epics
 
 }  // namespace sup
+
+namespace
+{
+sup::dto::AnyValue StripMetadata(const sup::dto::AnyValue& value)
+{
+  if (!sup::dto::IsStructValue(value))
+  {
+    return value;
+  }
+  auto result = sup::dto::EmptyStruct(value.GetTypeName());
+  for (const auto& member_name : value.MemberNames())
+  {
+    if (member_name != kAlarmField && member_name != kTimeStampField)
+    {
+      (void)result.AddMember(member_name, value[member_name]);
+    }
+  }
+  return result;
+}
+
+//! Copies the marked leaf fields of the value that was built from the cache onto the server's
+//! prototype. The cache may only hold part of the channel's fields (field selection or stripped
+//! metadata), so the prototype provides the channel's type and only the copied fields are marked.
+pvxs::Value ApplyToPrototype(const pvxs::Value& pvxs_value, pvxs::Value&& proto)
+{
+  for (auto field : pvxs_value.iall())
+  {
+    if (sup::epics::IsStruct(field) || !field.isMarked(true, false))
+    {
+      continue;
+    }
+    auto target = proto[pvxs_value.nameOf(field)];
+    if (!target.valid())
+    {
+      throw std::runtime_error("Error in PvAccessClientPV: field '" + pvxs_value.nameOf(field)
+                               + "' does not exist in the channel's type");
+    }
+    target.assign(field);
+    target.mark();
+  }
+  return std::move(proto);
+}
+
+}  // unnamed namespace
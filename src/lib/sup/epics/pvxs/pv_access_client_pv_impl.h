@@ -22,10 +22,13 @@
 #define SUP_EPICS_PV_ACCESS_CLIENT_PV_IMPL_H_
 
 #include <sup/epics/pv_access_client_pv.h>
+#include <sup/epics/utils/anyvalue_conversion_plan.h>
 
 #include <pvxs/client.h>
 
 #include <condition_variable>
+#include <future>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -50,11 +53,11 @@ public:
    * @param channel EPICS channel name.
    * @param context The PVXS client context to use.
    * @param cb Callback function to call when the variable's value or status changed.
-   *
-   * @return True if the variable was connected within the timeout period.
+   * @param config Configuration of the variable.
    */
   PvAccessClientPVImpl(const std::string& channel, std::shared_ptr<pvxs::client::Context> context,
-                       PvAccessClientPV::VariableChangedCallback cb = {});
+                       PvAccessClientPV::VariableChangedCallback cb = {},
+                       const PvAccessClientPVConfig& config = GetDefaultClientPVConfig());
   ~PvAccessClientPVImpl();
 
   PvAccessClientPVImpl(const PvAccessClientPVImpl&) = delete;
@@ -90,6 +93,16 @@ public:
    */
   PvAccessClientPV::ExtendedValue GetExtendedValue() const;
 
+  /**
+   * @brief Retrieve a view on a scalar array field of the last received PVXS value.
+   *
+   * @param field Path of the array field.
+   *
+   * @return View sharing the received buffer, or an empty view if unavailable.
+   */
+  template <typename T>
+  PvAccessArrayView<T> GetArrayView(const std::string& field) const;
+
     /**
    * @brief Write the value to the EPICS PvAccess server.
    *
@@ -99,6 +112,65 @@ public:
    */
   bool SetValue(const sup::dto::AnyValue& value);
 
+  /**
+   * @brief Write the value to the EPICS PvAccess server without waiting for the server's reply.
+   *
+   * @param value Value to be written.
+   *
+   * @return Future with the success status of the put.
+   */
+  std::future<bool> SetValueAsync(const sup::dto::AnyValue& value);
+
+  /**
+   * @brief Write the value to the EPICS PvAccess server without waiting for the server's reply.
+   *
+   * @param value Value to be written.
+   * @param cb Callback that is called once with the success status of the put. May be empty.
+   */
+  void SetValueAsync(const sup::dto::AnyValue& value, PvAccessClientPV::PutCompletionCallback cb);
+
+  /**
+   * @brief Write a single field to the EPICS PvAccess server. Only this field is sent.
+   *
+   * @param path Path of the field in the variable's structure, e.g. "a.b.c".
+   * @param value Value to be written to the field.
+   *
+   * @return True if successful, false otherwise.
+   */
+  bool SetField(const std::string& path, const sup::dto::AnyValue& value);
+
+  /**
+   * @brief Build the PVXS value for a put of the given value, without issuing it.
+   *
+   * @param value Value to be written.
+   * @param pvxs_value PVXS value to be sent.
+   *
+   * @return False if unconnected or if the value cannot be converted to the variable's type.
+   *
+   * @throws std::runtime_error for scalar values.
+   */
+  bool BuildPutValue(const sup::dto::AnyValue& value, pvxs::Value& pvxs_value) const;
+
+  /**
+   * @brief Issue a put of a value built with BuildPutValue.
+   *
+   * @param pvxs_value PVXS value to be sent.
+   * @param cb Callback that is called once with the success status of the put.
+   *
+   * @return Id of the issued put, or zero if it could not be issued.
+   */
+  sup::dto::uint64 IssuePut(const pvxs::Value& pvxs_value,
+                            PvAccessClientPV::PutCompletionCallback cb);
+
+  /**
+   * @brief Cancel an issued put without calling its callback.
+   *
+   * @param put_id Id of the put.
+   *
+   * @return False if the put already completed, in which case its callback was called.
+   */
+  bool CancelPut(sup::dto::uint64 put_id);
+
   /**
    * @brief This method waits for the variable to be connected with a timeout.
    *
@@ -119,15 +191,44 @@ public:
   bool WaitForValidValue(double timeout_sec) const;
 
 private:
+  //! References into the PVXS cache to the NormativeType metadata fields, which are invalid when
+  //! the variable's structure does not have them.
+  struct MetadataFields
+  {
+    pvxs::Value seconds;
+    pvxs::Value nanoseconds;
+    pvxs::Value status;
+    pvxs::Value severity;
+  };
+  struct PendingPut
+  {
+    std::shared_ptr<pvxs::client::Operation> operation;
+    PvAccessClientPV::PutCompletionCallback callback;
+    bool completed;
+  };
   void ProcessMonitor(pvxs::client::Subscription& sub);
+  void ApplyUpdate(const pvxs::Value& update);
+  //! Converts the complete update into the given value, without changing the cache.
+  bool ConvertUpdate(const pvxs::Value& update, sup::dto::AnyValue& value) const;
+  void DecodeMetadata();
+  //! Issues the put and cancels it when it does not complete within the put timeout.
+  bool PutAndWait(const pvxs::Value& pvxs_value);
+  void OnPutCompleted(sup::dto::uint64 put_id, bool success);
+  void CancelPuts();
   const std::string m_channel_name;
+  const PvAccessClientPVConfig m_config;
   std::shared_ptr<pvxs::client::Context> m_context;
   PvAccessClientPV::VariableChangedCallback m_changed_cb;
   PvAccessClientPV::ExtendedValue m_cache;
+  AnyValueConversionPlan m_conversion_plan;
+  pvxs::Value m_pvxs_cache;
+  MetadataFields m_metadata_fields;
   mutable std::mutex m_mon_mtx;
   mutable std::condition_variable m_cv;
   std::shared_ptr<pvxs::client::Subscription> m_subscription;
-  double m_max_put_timeout;
+  std::mutex m_put_mtx;
+  std::map<sup::dto::uint64, PendingPut> m_puts;
+  sup::dto::uint64 m_next_put_id;
 };
 
 }  // namespace epics
@@ -28,8 +28,6 @@
 #include <sup/epics/pvxs/pv_access_server_impl.h>
 #include <sup/epics/pvxs/pv_access_server_pv.h>
 
-#include <stdexcept>
-
 namespace sup
 {
 namespace epics
@@ -48,7 +46,13 @@ PvAccessServer::~PvAccessServer() = default;
 
 void PvAccessServer::AddVariable(const std::string& channel, const dto::AnyValue& any_value)
 {
-  p_impl->AddVariable(channel, any_value);
+  p_impl->AddVariable(channel, any_value, GetDefaultServerPVConfig());
+}
+
+void PvAccessServer::AddVariable(const std::string& channel, const dto::AnyValue& any_value,
+                                 const PvAccessServerPVConfig& config)
+{
+  p_impl->AddVariable(channel, any_value, config);
 }
 
 std::vector<std::string> PvAccessServer::GetVariableNames() const
@@ -58,36 +62,68 @@ std::vector<std::string> PvAccessServer::GetVariableNames() const
 
 dto::AnyValue PvAccessServer::GetValue(const std::string& channel) const
 {
-  auto iter = p_impl->GetVariables().find(channel);
-  if (iter == p_impl->GetVariables().end())
-  {
-    throw std::runtime_error("Error in PvAccessServer: non-existing variable name '" + channel
-                             + "'.");
-  }
-  return iter->second->GetValue();
+  auto variable = p_impl->GetVariable(channel);
+  return variable->GetValue();
 }
 
 bool PvAccessServer::SetValue(const std::string& channel, const dto::AnyValue& value)
 {
-  auto iter = p_impl->GetVariables().find(channel);
-  if (iter == p_impl->GetVariables().end())
-  {
-    throw std::runtime_error("Error in PvAccessServer: non-existing variable name '" + channel
-                             + "'.");
-  }
-  return iter->second->SetValue(value);
+  auto variable = p_impl->GetVariable(channel);
+  return variable->SetValue(value);
+}
+
+bool PvAccessServer::SetValues(const std::map<std::string, sup::dto::AnyValue>& values)
+{
+  return p_impl->SetValues(values);
+}
+
+template <typename T>
+bool PvAccessServer::SetArray(const std::string& channel, const PvAccessArrayView<T>& array,
+                              const std::string& field)
+{
+  auto variable = p_impl->GetVariable(channel);
+  variable->PublishArray(field, array);
+  variable->NotifyValueChanged();
+  return true;
+}
+
+template bool PvAccessServer::SetArray(
+  const std::string&, const PvAccessArrayView<sup::dto::boolean>&, const std::string&);
+template bool PvAccessServer::SetArray(
+  const std::string&, const PvAccessArrayView<sup::dto::int8>&, const std::string&);
+template bool PvAccessServer::SetArray(
+  const std::string&, const PvAccessArrayView<sup::dto::uint8>&, const std::string&);
+template bool PvAccessServer::SetArray(
+  const std::string&, const PvAccessArrayView<sup::dto::int16>&, const std::string&);
+template bool PvAccessServer::SetArray(
+  const std::string&, const PvAccessArrayView<sup::dto::uint16>&, const std::string&);
+template bool PvAccessServer::SetArray(
+  const std::string&, const PvAccessArrayView<sup::dto::int32>&, const std::string&);
+template bool PvAccessServer::SetArray(
+  const std::string&, const PvAccessArrayView<sup::dto::uint32>&, const std::string&);
+template bool PvAccessServer::SetArray(
+  const std::string&, const PvAccessArrayView<sup::dto::int64>&, const std::string&);
+template bool PvAccessServer::SetArray(
+  const std::string&, const PvAccessArrayView<sup::dto::uint64>&, const std::string&);
+template bool PvAccessServer::SetArray(
+  const std::string&, const PvAccessArrayView<sup::dto::float32>&, const std::string&);
+template bool PvAccessServer::SetArray(
+  const std::string&, const PvAccessArrayView<sup::dto::float64>&, const std::string&);
+
+PvAccessPostCounters PvAccessServer::GetPostCounters(const std::string& channel) const
+{
+  auto variable = p_impl->GetVariable(channel);
+  return variable->GetPostCounters();
+}
+
+void PvAccessServer::RemoveVariable(const std::string& channel)
+{
+  p_impl->RemoveVariable(channel);
 }
 
 void PvAccessServer::Start()
 {
-  auto& variables = p_impl->GetVariables();
-  for (const auto& [_, variable] : variables)
-  {
-    variable->AddToServer(*p_impl->GetContext());
-  }
-
-  // starting PVXS server
-  (void)p_impl->GetContext()->start();
+  p_impl->Start();
 }
 
 PvAccessClient PvAccessServer::CreateClient(PvAccessClient::VariableChangedCallback callback)
@@ -105,6 +141,13 @@ PvAccessClientPV PvAccessServer::CreateClientPV(const std::string& channel,
   return PvAccessClientPV{std::move(client_pv_impl)};
 }
 
+PvAccessServerPVConfig GetDefaultServerPVConfig()
+{
+  PvAccessServerPVConfig result;
+  result.max_post_rate = 0.0;
+  return result;
+}
+
 }  // namespace epics
 
 }  // namespace sup
@@ -26,6 +26,8 @@
 #include <pvxs/server.h>
 
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace sup
 {
@@ -37,6 +39,9 @@ PvAccessServerImpl::PvAccessServerImpl(std::unique_ptr<pvxs::server::Server>&& c
   , m_callback(std::move(callback))
   , m_variables{}
   , m_client_context{}
+  , m_started{false}
+  , m_variables_mtx{}
+  , m_group_mtx{}
 {}
 
 PvAccessServerImpl::~PvAccessServerImpl()
@@ -45,37 +50,108 @@ PvAccessServerImpl::~PvAccessServerImpl()
 }
 
 //! Adds channel with given name to the map of channels.
-void PvAccessServerImpl::AddVariable(const std::string& name, const dto::AnyValue& any_value)
+void PvAccessServerImpl::AddVariable(const std::string& name, const dto::AnyValue& any_value,
+                                     const PvAccessServerPVConfig& config)
 {
+  PvAccessServerPV::VariableChangedCallback variable_callback;
+  if (m_callback)
+  {
+    variable_callback = [this, name](const sup::dto::AnyValue& any_value)
+    { OnVariableChanged(name, any_value); };
+  }
+
+  auto variable =
+    std::make_shared<PvAccessServerPV>(name, any_value, variable_callback, config);
+  std::unique_lock<std::shared_mutex> lk(m_variables_mtx);
   auto iter = m_variables.find(name);
   if (iter != m_variables.end())
   {
     throw std::runtime_error("Error in PvAccessServer: existing variable name '" + name + "'.");
   }
+  if (m_started)
+  {
+    variable->AddToServer(*m_context);
+  }
+  (void)m_variables.emplace(name, std::move(variable));
+}
 
-  PvAccessServerPV::VariableChangedCallback variable_callback;
-  if (m_callback)
+//! Removes channel with given name. Clients of other channels are not affected.
+void PvAccessServerImpl::RemoveVariable(const std::string& name)
+{
+  std::shared_ptr<PvAccessServerPV> variable;
   {
-    variable_callback = [this, name](const sup::dto::AnyValue& any_value)
-    { OnVariableChanged(name, any_value); };
+    std::unique_lock<std::shared_mutex> lk(m_variables_mtx);
+    auto iter = m_variables.find(name);
+    if (iter == m_variables.end())
+    {
+      throw std::runtime_error("Error in PvAccessServer: non-existing variable name '" + name
+                               + "'.");
+    }
+    if (m_started)
+    {
+      iter->second->RemoveFromServer(*m_context);
+    }
+    variable = std::move(iter->second);
+    (void)m_variables.erase(iter);
+  }
+  // The variable is only destroyed here when no other thread is still using it.
+}
+
+void PvAccessServerImpl::Start()
+{
+  std::unique_lock<std::shared_mutex> lk(m_variables_mtx);
+  for (const auto& [_, variable] : m_variables)
+  {
+    variable->AddToServer(*m_context);
   }
 
-  auto variable = std::make_unique<PvAccessServerPV>(name, any_value, variable_callback);
-  (void)m_variables.emplace(name, std::move(variable));
+  // starting PVXS server
+  (void)m_context->start();
+  m_started = true;
+}
+
+bool PvAccessServerImpl::SetValues(const std::map<std::string, sup::dto::AnyValue>& values)
+{
+  // Converting all values first ensures that either all or none of the variables are changed.
+  std::vector<std::pair<std::shared_ptr<PvAccessServerPV>, sup::dto::AnyValue>> updates;
+  for (const auto& [name, value] : values)
+  {
+    auto variable = GetVariable(name);
+    auto converted = variable->ConvertValue(value);
+    updates.emplace_back(std::move(variable), std::move(converted));
+  }
+  {
+    std::lock_guard<std::mutex> lk(m_group_mtx);
+    for (const auto& [variable, value] : updates)
+    {
+      variable->PublishValue(value);
+    }
+  }
+  for (const auto& [variable, _] : updates)
+  {
+    variable->NotifyValueChanged();
+  }
+  return true;
 }
 
 std::vector<std::string> PvAccessServerImpl::GetVariableNames() const
 {
+  std::shared_lock<std::shared_mutex> lk(m_variables_mtx);
   std::vector<std::string> result;
   (void)std::transform(std::begin(m_variables), end(m_variables), back_inserter(result),
                        [](const auto& pair) { return pair.first; });
   return result;
 }
 
-const std::map<std::string, std::unique_ptr<PvAccessServerPV>>&
-PvAccessServerImpl::GetVariables() const
+std::shared_ptr<PvAccessServerPV> PvAccessServerImpl::GetVariable(const std::string& name) const
 {
-  return m_variables;
+  std::shared_lock<std::shared_mutex> lk(m_variables_mtx);
+  auto iter = m_variables.find(name);
+  if (iter == m_variables.end())
+  {
+    throw std::runtime_error("Error in PvAccessServer: non-existing variable name '" + name + "'.");
+  }
+  return iter->second;
 }
 
 std::unique_ptr<pvxs::server::Server>& PvAccessServerImpl::GetContext()
@@ -26,6 +26,8 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 
 namespace sup
 {
@@ -39,12 +41,26 @@ public:
 
   ~PvAccessServerImpl();
 
-  //! Adds channel with given name to the map of channels.
-  void AddVariable(const std::string& name, const dto::AnyValue& any_value);
+  //! Adds channel with given name to the map of channels. It is published immediately if the
+  //! server was already started.
+  void AddVariable(const std::string& name, const dto::AnyValue& any_value,
+                   const PvAccessServerPVConfig& config);
+
+  //! Removes channel with given name from the map of channels and from the running server.
+  void RemoveVariable(const std::string& name);
+
+  //! Publishes all channels and starts the server.
+  void Start();
+
+  //! Sets the values of multiple channels. All values are converted before any of them is
+  //! published, and they are posted back to back while holding the group update lock.
+  bool SetValues(const std::map<std::string, sup::dto::AnyValue>& values);
 
   std::vector<std::string> GetVariableNames() const;
 
-  const std::map<std::string, std::unique_ptr<PvAccessServerPV>>& GetVariables() const;
+  //! Returns the channel with given name. Will throw if the channel does not exist. The channel
+  //! stays valid while it is used, even when it is removed concurrently.
+  std::shared_ptr<PvAccessServerPV> GetVariable(const std::string& name) const;
 
   std::unique_ptr<pvxs::server::Server>& GetContext();
 
@@ -54,8 +70,11 @@ private:
   void OnVariableChanged(const std::string& name, const sup::dto::AnyValue& any_value);
   std::unique_ptr<pvxs::server::Server> m_context;
   PvAccessServer::VariableChangedCallback m_callback;
-  std::map<std::string, std::unique_ptr<PvAccessServerPV>> m_variables;
+  std::map<std::string, std::shared_ptr<PvAccessServerPV>> m_variables;
   std::shared_ptr<pvxs::client::Context> m_client_context;
+  bool m_started;
+  mutable std::shared_mutex m_variables_mtx;  //!< Guards m_variables and m_started
+  std::mutex m_group_mtx;  //!< Serializes group updates against each other only
 };
 
 //! Creates PvAccess server implementation suitable for unit tests.
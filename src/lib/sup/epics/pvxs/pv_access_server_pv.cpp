@@ -20,31 +20,86 @@
 
 #include "sup/epics/pvxs/pv_access_server_pv.h"
 
+#include "pv_access_utils.h"
+
+#include <sup/epics/utils/dto_scalar_conversion_utils.h>
+
 #include <stdexcept>
+#include <vector>
 
 namespace sup
 {
 namespace epics
 {
 
+//! Forwards put operations of the SharedPV to the variable. It is detached when the variable is
+//! destroyed, which waits for a running put to finish. Later puts are refused.
+struct PvAccessServerPV::PutHandler
+{
+  std::mutex m_mutex;
+  PvAccessServerPV* m_variable;
+};
+
 PvAccessServerPV::PvAccessServerPV(const std::string& variable_name,
                                    const sup::dto::AnyValue& any_value,
-                                   VariableChangedCallback callback)
+                                   VariableChangedCallback callback,
+                                   const PvAccessServerPVConfig& config)
   : m_variable_name(variable_name)
   , m_any_value(any_value)
   , m_pvxs_cache(BuildPVXSValue(m_any_value))
+  , m_update_plan()
+  , m_cache_outdated(false)
+  , m_outdated_fields()
+  , m_mirror_outdated(false)
+  , m_mirror_plan()
   , m_callback(std::move(callback))
   , m_shared_pv(pvxs::server::SharedPV::buildMailbox())
+  , m_put_handler(std::make_shared<PutHandler>())
+  , m_min_post_interval()
+  , m_next_post_time()
+  , m_post_pending(false)
+  , m_counters()
+  , m_scheduler()
 {
   if (sup::dto::IsScalarValue(any_value))
   {
     throw std::runtime_error("Error in PvAccessServerPV: cannot publish a scalar value");
   }
-  using namespace std::placeholders;
-  m_shared_pv.onPut(std::bind(&PvAccessServerPV::OnSharedValueChanged, this, _1, _2, _3));
+  if (config.max_post_rate < 0.0)
+  {
+    throw std::runtime_error("Error in PvAccessServerPV: negative maximum post rate");
+  }
+  if (config.max_post_rate > 0.0)
+  {
+    m_min_post_interval = std::chrono::duration_cast<TaskScheduler::Clock::duration>(
+      std::chrono::duration<double>(1.0 / config.max_post_rate));
+    m_scheduler = utils::GetSharedTaskScheduler();
+  }
+  m_put_handler->m_variable = this;
+  auto put_handler = m_put_handler;
+  m_shared_pv.onPut(
+    [put_handler](pvxs::server::SharedPV& pv, std::unique_ptr<pvxs::server::ExecOp>&& op,
+                  pvxs::Value&& value)
+    {
+      std::lock_guard<std::mutex> lock(put_handler->m_mutex);
+      if (put_handler->m_variable == nullptr)
+      {
+        op->error("Variable was removed from the server");
+        return;
+      }
+      put_handler->m_variable->OnSharedValueChanged(pv, std::move(op), std::move(value));
+    });
 }
 
-PvAccessServerPV::~PvAccessServerPV() = default;
+PvAccessServerPV::~PvAccessServerPV()
+{
+  if (m_scheduler)
+  {
+    m_scheduler->Cancel(this);
+  }
+  std::lock_guard<std::mutex> lock(m_put_handler->m_mutex);
+  m_put_handler->m_variable = nullptr;
+}
 
 std::string PvAccessServerPV::GetVariableName() const
 {
@@ -54,43 +109,122 @@ std::string PvAccessServerPV::GetVariableName() const
 dto::AnyValue PvAccessServerPV::GetValue() const
 {
   std::lock_guard<std::mutex> lock(m_mutex);
+  UpdateMirror();
   return m_any_value;
 }
 
 bool PvAccessServerPV::SetValue(const dto::AnyValue& value)
+{
+  PublishValue(value);
+  NotifyValueChanged();
+  return true;
+}
+
+dto::AnyValue PvAccessServerPV::ConvertValue(const dto::AnyValue& value) const
 {
   if (sup::dto::IsScalarValue(value))
   {
     throw std::runtime_error("Error in PvAccessServerPV: cannot set a scalar value");
   }
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (sup::dto::IsEmptyValue(m_any_value))
   {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    if (sup::dto::IsEmptyValue(m_any_value))
-    {
-      m_any_value = value;
-    }
-    else
-    {
-      m_any_value.ConvertFrom(value);
-    }
+    return value;
   }
-  // assigning value to shared variable
-  if (m_shared_pv.isOpen())
+  UpdateMirror();
+  auto result = m_any_value;
+  result.ConvertFrom(value);
+  return result;
+}
+
+void PvAccessServerPV::PublishValue(const dto::AnyValue& value)
+{
+  if (sup::dto::IsScalarValue(value))
+  {
+    throw std::runtime_error("Error in PvAccessServerPV: cannot set a scalar value");
+  }
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (sup::dto::IsEmptyValue(m_any_value))
+  {
+    m_any_value = value;
+    m_update_plan.Reset();
+    m_mirror_plan.Reset();
+  }
+  else
   {
-    // Simple copy doesn't work. We have to keep m_pvxs_cache internal storage's pointer
-    // alive since server::SharedPV relies on that.
+    UpdateMirror();
+    m_any_value.ConvertFrom(value);
+  }
+  m_cache_outdated = true;
+  Post();
+}
+
+void PvAccessServerPV::NotifyValueChanged()
+{
+  if (m_callback)  // for some reason `post` doesn't trigger OnSharedValueChanged
+  {
+    // The main value is updated lazily by other threads, so the callback receives a copy.
+    sup::dto::AnyValue value;
     {
       std::lock_guard<std::mutex> lock(m_mutex);
-      auto pvxs_value = BuildPVXSValue(m_any_value);
-      (void)m_pvxs_cache.assign(pvxs_value);
+      UpdateMirror();
+      value = m_any_value;
     }
-    m_shared_pv.post(m_pvxs_cache);
+    m_callback(value);
   }
-  if (m_callback)  // for some reason `post` above doesn't trigger OnSharedValueChanged
+}
+
+template <typename T>
+void PvAccessServerPV::PublishArray(const std::string& field, const PvAccessArrayView<T>& array)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto field_value = m_pvxs_cache[field];
+  if (!field_value.valid() || field_value.type() != utils::ArrayTypeCode<T>()
+      || !m_any_value.HasField(field) || m_any_value[field].NumberOfElements() != array.size())
   {
-    m_callback(m_any_value);
+    throw std::runtime_error("Error in PvAccessServerPV: field '" + field
+                             + "' is not a scalar array of the given type and size");
   }
-  return true;
+  // Changes of the main value have to be in the cache before the array is placed in it, since
+  // the update plan would otherwise overwrite the array with the outdated main value.
+  if (m_cache_outdated)
+  {
+    UpdateCache();
+  }
+  // The element types match, so the field shares the array's buffer without copying it.
+  pvxs::shared_array<const T> pvxs_array(array.shared_data(), array.size());
+  field_value = pvxs_array.template castTo<const void>();
+  (void)m_outdated_fields.insert(field);
+  Post();
+}
+
+template void PvAccessServerPV::PublishArray(const std::string&,
+                                             const PvAccessArrayView<sup::dto::boolean>&);
+template void PvAccessServerPV::PublishArray(const std::string&,
+                                             const PvAccessArrayView<sup::dto::int8>&);
+template void PvAccessServerPV::PublishArray(const std::string&,
+                                             const PvAccessArrayView<sup::dto::uint8>&);
+template void PvAccessServerPV::PublishArray(const std::string&,
+                                             const PvAccessArrayView<sup::dto::int16>&);
+template void PvAccessServerPV::PublishArray(const std::string&,
+                                             const PvAccessArrayView<sup::dto::uint16>&);
+template void PvAccessServerPV::PublishArray(const std::string&,
+                                             const PvAccessArrayView<sup::dto::int32>&);
+template void PvAccessServerPV::PublishArray(const std::string&,
+                                             const PvAccessArrayView<sup::dto::uint32>&);
+template void PvAccessServerPV::PublishArray(const std::string&,
+                                             const PvAccessArrayView<sup::dto::int64>&);
+template void PvAccessServerPV::PublishArray(const std::string&,
+                                             const PvAccessArrayView<sup::dto::uint64>&);
+template void PvAccessServerPV::PublishArray(const std::string&,
+                                             const PvAccessArrayView<sup::dto::float32>&);
+template void PvAccessServerPV::PublishArray(const std::string&,
+                                             const PvAccessArrayView<sup::dto::float64>&);
+
+PvAccessPostCounters PvAccessServerPV::GetPostCounters() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_counters;
 }
 
 void PvAccessServerPV::AddToServer(pvxs::server::Server& server)
@@ -100,29 +234,165 @@ void PvAccessServerPV::AddToServer(pvxs::server::Server& server)
     throw std::runtime_error("Variable was already added to a server");
   }
   (void)server.addPV(m_variable_name, m_shared_pv);
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_cache_outdated)
+  {
+    UpdateCache();
+  }
+  // Marking the top level structure covers all its fields, so new clients receive them all.
+  m_pvxs_cache.mark();
   m_shared_pv.open(m_pvxs_cache);
+  m_pvxs_cache.unmark(false, true);
+}
+
+void PvAccessServerPV::RemoveFromServer(pvxs::server::Server& server)
+{
+  // Closing the SharedPV disconnects the clients, they will not find the channel anymore after
+  // its removal from the server.
+  (void)server.removePV(m_variable_name);
+  // Posts check under the same lock that the variable is still open.
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_shared_pv.close();
 }
 
 void PvAccessServerPV::OnSharedValueChanged(pvxs::server::SharedPV& /*pv*/,
                                             std::unique_ptr<pvxs::server::ExecOp>&& op,
                                             pvxs::Value&& value)
 {
+  sup::dto::AnyValue callback_value;
   {
     std::lock_guard<std::mutex> lock(m_mutex);
-    m_any_value = BuildAnyValue(value);
-
+    if (m_cache_outdated)
+    {
+      UpdateCache();
+    }
     // Simple copy doesn't work. We have to keep m_pvxs_cache internal storage's pointer alive
-    // since server::SharedPV relies on that.
+    // since server::SharedPV relies on that. The cache is the only place where the put value is
+    // stored: the main value is only converted from it when needed.
     (void)m_pvxs_cache.assign(value);
-    m_shared_pv.post(m_pvxs_cache);
+    m_mirror_outdated = true;
+    // Client puts are rate limited and counted like the server's own updates.
+    Post();
+    if (m_callback)
+    {
+      UpdateMirror();
+      callback_value = m_any_value;
+    }
   }
   if (m_callback)
   {
-    m_callback(m_any_value);
+    m_callback(callback_value);
   }
   op->reply();
 }
 
+//! Posts the changes of the cache, unless it is not open or the post rate does not allow it yet.
+//! Must be called with the lock held.
+void PvAccessServerPV::Post()
+{
+  if (!m_shared_pv.isOpen())
+  {
+    return;
+  }
+  if (m_scheduler)
+  {
+    if (m_post_pending)
+    {
+      // The pending post will send this value instead of the previous one.
+      ++m_counters.dropped;
+      return;
+    }
+    if (TaskScheduler::Clock::now() < m_next_post_time)
+    {
+      m_post_pending = true;
+      m_scheduler->Schedule(this, m_next_post_time, [this]{ PostPending(); });
+      return;
+    }
+  }
+  PostCache();
+}
+
+void PvAccessServerPV::PostPending()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_post_pending = false;
+  if (m_shared_pv.isOpen())
+  {
+    PostCache();
+  }
+}
+
+//! Posts the changes of the cache. Must be called with the lock held.
+void PvAccessServerPV::PostCache()
+{
+  if (m_cache_outdated)
+  {
+    UpdateCache();
+  }
+  m_shared_pv.post(m_pvxs_cache);
+  // The marks of the cache always hold the changes that were not posted yet.
+  m_pvxs_cache.unmark(false, true);
+  ++m_counters.posted;
+  m_next_post_time = TaskScheduler::Clock::now() + m_min_post_interval;
+}
+
+//! Updates the PVXS cache from the main value. Must be called with the lock held.
+void PvAccessServerPV::UpdateCache()
+{
+  // Simple copy doesn't work. We have to keep m_pvxs_cache internal storage's pointer
+  // alive since server::SharedPV relies on that. The update plan only assigns and marks the
+  // changed fields of the cache, so the post sends a delta. If the value's layout is not
+  // supported by the plan, the value is rebuilt instead, without compiling the plan again.
+  UpdateMirror();
+  std::vector<pvxs::Value> unposted;
+  for (auto field : m_pvxs_cache.imarked())
+  {
+    unposted.push_back(field);
+  }
+  if (!m_update_plan.IsCompiled() && !m_update_plan.IsUnsupported())
+  {
+    (void)m_update_plan.Compile(m_pvxs_cache, m_any_value);
+  }
+  if (!m_update_plan.Apply())
+  {
+    auto pvxs_value = BuildPVXSValue(m_any_value);
+    (void)m_pvxs_cache.assign(pvxs_value);
+  }
+  // Applying the plan unmarks the cache, so changes that were not posted yet are marked again.
+  for (auto& field : unposted)
+  {
+    field.mark();
+  }
+  m_cache_outdated = false;
+}
+
+//! Updates the fields of the main value that were only written to the cache, i.e. by client puts
+//! or array publishing. Must be called with the lock held.
+void PvAccessServerPV::UpdateMirror() const
+{
+  if (m_mirror_outdated)
+  {
+    // The conversion plan assigns the members in place, so that the update plan's references to
+    // the main value stay valid.
+    if (!m_mirror_plan.IsCompiled())
+    {
+      (void)m_mirror_plan.Compile(m_pvxs_cache, m_any_value);
+    }
+    if (!m_mirror_plan.Apply(m_pvxs_cache, false))
+    {
+      m_any_value.ConvertFrom(BuildAnyValue(m_pvxs_cache));
+    }
+    m_mirror_outdated = false;
+    m_outdated_fields.clear();
+    return;
+  }
+  for (const auto& field : m_outdated_fields)
+  {
+    m_any_value[field].ConvertFrom(GetAnyValueFromScalarArray(m_pvxs_cache[field]));
+  }
+  m_outdated_fields.clear();
+}
+
 }  // namespace epics
 
 }  // namespace sup
@@ -21,7 +21,12 @@
 #ifndef SUP_EPICS_PV_ACCESS_SERVER_PV_H_
 #define SUP_EPICS_PV_ACCESS_SERVER_PV_H_
 
+#include <sup/epics/pv_access_array_view.h>
+#include <sup/epics/pv_access_server.h>
+#include <sup/epics/pvxs/pv_access_task_scheduler.h>
+#include <sup/epics/utils/anyvalue_conversion_plan.h>
 #include <sup/epics/utils/dto_conversion_utils.h>
+#include <sup/epics/utils/pvxs_update_plan.h>
 
 #include <sup/dto/anyvalue.h>
 
@@ -30,7 +35,9 @@
 #include <pvxs/sharedpv.h>
 
 #include <functional>
+#include <memory>
 #include <mutex>
+#include <set>
 #include <string>
 
 namespace sup
@@ -50,7 +57,8 @@ public:
   using VariableChangedCallback = std::function<void(const sup::dto::AnyValue&)>;
 
   PvAccessServerPV(const std::string& variable_name, const sup::dto::AnyValue& any_value,
-                         VariableChangedCallback callback);
+                   VariableChangedCallback callback,
+                   const PvAccessServerPVConfig& config = GetDefaultServerPVConfig());
   ~PvAccessServerPV();
 
   PvAccessServerPV(const PvAccessServerPV&) = delete;
@@ -65,21 +73,64 @@ public:
   sup::dto::AnyValue GetValue() const;
 
   //! The PVXS variable held in the cache is assigned with the <value> parameter and marked for
-  //! asynchronous update. Will throw if assignment was not possible.
+  //! asynchronous update. Only the fields that changed are marked, so that a delta is posted.
+  //! Will throw if assignment was not possible.
   bool SetValue(const sup::dto::AnyValue& value);
 
+  //! Returns the <value> parameter converted to the type of this variable, without changing the
+  //! variable. Will throw if conversion is not possible.
+  sup::dto::AnyValue ConvertValue(const sup::dto::AnyValue& value) const;
+
+  //! First part of SetValue: assigns the <value> parameter and posts the changed fields, but does
+  //! not call the callback. Will throw if assignment was not possible. When the post rate is
+  //! limited, the post may be deferred and conflated with later values.
+  void PublishValue(const sup::dto::AnyValue& value);
+
+  //! Second part of SetValue: calls the callback with the current value.
+  void NotifyValueChanged();
+
+  //! Replaces the scalar array <field> by the given array, sharing its buffer instead of copying
+  //! it, and posts only this field. The AnyValue mirror of the field is only updated when it is
+  //! needed (e.g. by GetValue or the callback). Will throw if the field is not a scalar array with
+  //! the same element type and number of elements.
+  template <typename T>
+  void PublishArray(const std::string& field, const PvAccessArrayView<T>& array);
+
+  //! Returns the counters of posted and dropped value updates.
+  PvAccessPostCounters GetPostCounters() const;
+
   //! Add variable to given server. Will throw if variable has been already added.
   void AddToServer(pvxs::server::Server& server);
 
+  //! Remove variable from given server, disconnecting its clients. The server may be running.
+  void RemoveFromServer(pvxs::server::Server& server);
+
 private:
+  struct PutHandler;
   void OnSharedValueChanged(pvxs::server::SharedPV& pv,
                             std::unique_ptr<pvxs::server::ExecOp>&& op, pvxs::Value&& value);
+  void Post();
+  void PostPending();
+  void PostCache();
+  void UpdateCache();
+  void UpdateMirror() const;
   const std::string m_variable_name;
-  sup::dto::AnyValue m_any_value;  //!< The main value of this variable.
+  mutable sup::dto::AnyValue m_any_value;  //!< The main value of this variable.
   pvxs::Value m_pvxs_cache;        //!< Necessary for open/post operations of SharedPV
+  PvxsUpdatePlan m_update_plan;    //!< Updates the cache in place from the main value
+  bool m_cache_outdated;           //!< Main value has changes that are not in the cache yet
+  mutable std::set<std::string> m_outdated_fields;  //!< Array fields only updated in the cache
+  mutable bool m_mirror_outdated;  //!< Main value is behind the cache after a client put
+  mutable AnyValueConversionPlan m_mirror_plan;  //!< Updates the main value in place from the cache
   VariableChangedCallback m_callback;
   pvxs::server::SharedPV m_shared_pv;
   mutable std::mutex m_mutex;
+  std::shared_ptr<PutHandler> m_put_handler;
+  TaskScheduler::Clock::duration m_min_post_interval;  //!< Zero if the post rate is not limited
+  TaskScheduler::Clock::time_point m_next_post_time;
+  bool m_post_pending;
+  PvAccessPostCounters m_counters;
+  std::shared_ptr<TaskScheduler> m_scheduler;
 };
 
 }  // namespace epics
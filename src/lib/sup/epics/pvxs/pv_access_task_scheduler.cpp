@@ -0,0 +1,120 @@
+/******************************************************************************
+ *
+ * Project       : Supervision and automation system EPICS interface
+ *
+ * Description   : Library of SUP components for EPICS network protocol
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "pv_access_task_scheduler.h"
+
+#include <utility>
+
+namespace sup
+{
+namespace epics
+{
+
+TaskScheduler::TaskScheduler()
+  : m_mtx{}
+  , m_cv{}
+  , m_queue{}
+  , m_tasks{}
+  , m_running_key{nullptr}
+  , m_halt{false}
+  , m_thread{}
+{
+  m_thread = std::thread(&TaskScheduler::Run, this);
+}
+
+TaskScheduler::~TaskScheduler()
+{
+  {
+    std::lock_guard<std::mutex> lk{m_mtx};
+    m_halt = true;
+  }
+  m_cv.notify_all();
+  m_thread.join();
+}
+
+void TaskScheduler::Schedule(const void* key, Clock::time_point when, Task task)
+{
+  {
+    std::lock_guard<std::mutex> lk{m_mtx};
+    (void)RemoveTask(key);
+    auto queue_iter = m_queue.emplace(when, key);
+    (void)m_tasks.emplace(key, ScheduledTask{queue_iter, std::move(task)});
+  }
+  m_cv.notify_all();
+}
+
+void TaskScheduler::Cancel(const void* key)
+{
+  std::unique_lock<std::mutex> lk{m_mtx};
+  (void)RemoveTask(key);
+  m_cv.wait(lk, [this, key]{ return m_running_key != key; });
+}
+
+bool TaskScheduler::Remove(const void* key)
+{
+  std::lock_guard<std::mutex> lk{m_mtx};
+  return RemoveTask(key);
+}
+
+void TaskScheduler::Run()
+{
+  std::unique_lock<std::mutex> lk{m_mtx};
+  while (!m_halt)
+  {
+    if (m_queue.empty())
+    {
+      m_cv.wait(lk);
+      continue;
+    }
+    auto next = m_queue.begin();
+    if (Clock::now() < next->first)
+    {
+      (void)m_cv.wait_until(lk, next->first);
+      continue;
+    }
+    auto key = next->second;
+    auto task_iter = m_tasks.find(key);
+    auto task = std::move(task_iter->second.m_task);
+    (void)m_tasks.erase(task_iter);
+    (void)m_queue.erase(next);
+    m_running_key = key;
+    lk.unlock();
+    task();
+    lk.lock();
+    m_running_key = nullptr;
+    m_cv.notify_all();
+  }
+}
+
+bool TaskScheduler::RemoveTask(const void* key)
+{
+  auto task_iter = m_tasks.find(key);
+  if (task_iter == m_tasks.end())
+  {
+    return false;
+  }
+  (void)m_queue.erase(task_iter->second.m_queue_iter);
+  (void)m_tasks.erase(task_iter);
+  return true;
+}
+
+}  // namespace epics
+
+}  // namespace sup
@@ -0,0 +1,90 @@
+/******************************************************************************
+ *
+ * Project       : Supervision and automation system EPICS interface
+ *
+ * Description   : Library of SUP components for EPICS network protocol
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_EPICS_PV_ACCESS_TASK_SCHEDULER_H_
+#define SUP_EPICS_PV_ACCESS_TASK_SCHEDULER_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace sup
+{
+namespace epics
+{
+
+//! Runs delayed tasks, e.g. posts of rate limited server variables or timeouts of asynchronous RPC
+//! calls, on a single worker thread.
+//!
+//! @details Each client of the scheduler (identified by a key) has at most one scheduled task.
+//! Tasks are run in the order of their scheduled time.
+
+class TaskScheduler
+{
+public:
+  using Clock = std::chrono::steady_clock;
+  using Task = std::function<void()>;
+
+  TaskScheduler();
+  ~TaskScheduler();
+
+  TaskScheduler(const TaskScheduler&) = delete;
+  TaskScheduler& operator=(const TaskScheduler&) = delete;
+  TaskScheduler(TaskScheduler&&) = delete;
+  TaskScheduler& operator=(TaskScheduler&&) = delete;
+
+  //! Schedules the task to run at the given time, replacing a task that was already scheduled for
+  //! the same key.
+  void Schedule(const void* key, Clock::time_point when, Task task);
+
+  //! Removes the scheduled task for the given key and waits for it to finish if it is running.
+  //! Must not be called from a task.
+  void Cancel(const void* key);
+
+  //! Removes the scheduled task for the given key without waiting. Returns false if no task was
+  //! scheduled for the key, e.g. because it is already running. Can be called from a task.
+  bool Remove(const void* key);
+
+private:
+  struct ScheduledTask
+  {
+    std::multimap<Clock::time_point, const void*>::iterator m_queue_iter;
+    Task m_task;
+  };
+  void Run();
+  bool RemoveTask(const void* key);
+  std::mutex m_mtx;
+  std::condition_variable m_cv;
+  std::multimap<Clock::time_point, const void*> m_queue;
+  std::unordered_map<const void*, ScheduledTask> m_tasks;
+  const void* m_running_key;
+  bool m_halt;
+  std::thread m_thread;
+};
+
+}  // namespace epics
+
+}  // namespace sup
+
+#endif  // SUP_EPICS_PV_ACCESS_TASK_SCHEDULER_H_
@@ -20,7 +20,10 @@
 
 #include "pv_access_utils.h"
 
+#include <map>
 #include <mutex>
+#include <sstream>
+#include <stdexcept>
 
 namespace sup
 {
@@ -36,6 +39,73 @@ std::shared_ptr<pvxs::client::Context> GetSharedClientContext()
   return context;
 }
 
+std::mutex g_context_mtx;
+
+std::map<std::string, std::shared_ptr<pvxs::client::Context>>& GetClientContextRegistry()
+{
+  static std::map<std::string, std::shared_ptr<pvxs::client::Context>> registry;
+  return registry;
+}
+
+void RegisterClientContext(const std::string& name,
+                           std::shared_ptr<pvxs::client::Context> context)
+{
+  if (name.empty() || !context)
+  {
+    throw std::runtime_error("RegisterClientContext(): empty name or context");
+  }
+  std::lock_guard<std::mutex> lk{g_context_mtx};
+  if (!GetClientContextRegistry().emplace(name, std::move(context)).second)
+  {
+    throw std::runtime_error("RegisterClientContext(): existing context name '" + name + "'");
+  }
+}
+
+bool HasClientContext(const std::string& name)
+{
+  if (name.empty())
+  {
+    return true;
+  }
+  std::lock_guard<std::mutex> lk{g_context_mtx};
+  auto& registry = GetClientContextRegistry();
+  return registry.find(name) != registry.end();
+}
+
+std::shared_ptr<pvxs::client::Context> GetClientContext(const std::string& name)
+{
+  if (name.empty())
+  {
+    return GetSharedClientContext();
+  }
+  std::lock_guard<std::mutex> lk{g_context_mtx};
+  auto& registry = GetClientContextRegistry();
+  auto iter = registry.find(name);
+  if (iter == registry.end())
+  {
+    throw std::runtime_error("GetClientContext(): unknown context name '" + name + "'");
+  }
+  return iter->second;
+}
+
+std::vector<std::string> GetFieldSelection(const std::string& fields)
+{
+  std::vector<std::string> result;
+  std::istringstream istr(fields);
+  std::string field;
+  while (std::getline(istr, field, ','))
+  {
+    auto begin = field.find_first_not_of(' ');
+    if (begin == std::string::npos)
+    {
+      continue;
+    }
+    auto end = field.find_last_not_of(' ');
+    result.push_back(field.substr(begin, end - begin + 1));
+  }
+  return result;
+}
+
 std::mutex g_server_mtx;
 
 std::unique_ptr<pvxs::server::Server> CreateIsolatedServer()
@@ -50,6 +120,126 @@ std::unique_ptr<pvxs::server::Server> CreateServerFromEnv()
   return std::make_unique<pvxs::server::Server>(pvxs::server::Config::fromEnv());
 }
 
+std::map<std::string, std::weak_ptr<pvxs::server::Server>>& GetSharedServerRegistry()
+{
+  static std::map<std::string, std::weak_ptr<pvxs::server::Server>> registry;
+  return registry;
+}
+
+std::shared_ptr<pvxs::server::Server> GetSharedServer(const std::string& group)
+{
+  std::lock_guard<std::mutex> lk{g_server_mtx};
+  auto& entry = GetSharedServerRegistry()[group];
+  auto result = entry.lock();
+  if (!result)
+  {
+    auto server = std::make_unique<pvxs::server::Server>(pvxs::server::Config::fromEnv());
+    result = std::shared_ptr<pvxs::server::Server>(server.release(),
+                                                   [](pvxs::server::Server* server_ptr)
+                                                   {
+                                                     (void)server_ptr->stop();
+                                                     delete server_ptr;
+                                                   });
+    (void)result->start();
+    entry = result;
+  }
+  return result;
+}
+
+std::mutex g_scheduler_mtx;
+
+std::shared_ptr<TaskScheduler> GetSharedTaskScheduler()
+{
+  static std::weak_ptr<TaskScheduler> shared_scheduler;
+  std::lock_guard<std::mutex> lk{g_scheduler_mtx};
+  auto result = shared_scheduler.lock();
+  if (!result)
+  {
+    result = std::make_shared<TaskScheduler>();
+    shared_scheduler = result;
+  }
+  return result;
+}
+
+std::shared_ptr<TaskScheduler> GetSharedRPCTimeoutScheduler()
+{
+  static std::weak_ptr<TaskScheduler> shared_scheduler;
+  std::lock_guard<std::mutex> lk{g_scheduler_mtx};
+  auto result = shared_scheduler.lock();
+  if (!result)
+  {
+    result = std::make_shared<TaskScheduler>();
+    shared_scheduler = result;
+  }
+  return result;
+}
+
+template <>
+pvxs::TypeCode ArrayTypeCode<sup::dto::boolean>()
+{
+  return pvxs::TypeCode::BoolA;
+}
+
+template <>
+pvxs::TypeCode ArrayTypeCode<sup::dto::int8>()
+{
+  return pvxs::TypeCode::Int8A;
+}
+
+template <>
+pvxs::TypeCode ArrayTypeCode<sup::dto::uint8>()
+{
+  return pvxs::TypeCode::UInt8A;
+}
+
+template <>
+pvxs::TypeCode ArrayTypeCode<sup::dto::int16>()
+{
+  return pvxs::TypeCode::Int16A;
+}
+
+template <>
+pvxs::TypeCode ArrayTypeCode<sup::dto::uint16>()
+{
+  return pvxs::TypeCode::UInt16A;
+}
+
+template <>
+pvxs::TypeCode ArrayTypeCode<sup::dto::int32>()
+{
+  return pvxs::TypeCode::Int32A;
+}
+
+template <>
+pvxs::TypeCode ArrayTypeCode<sup::dto::uint32>()
+{
+  return pvxs::TypeCode::UInt32A;
+}
+
+template <>
+pvxs::TypeCode ArrayTypeCode<sup::dto::int64>()
+{
+  return pvxs::TypeCode::Int64A;
+}
+
+template <>
+pvxs::TypeCode ArrayTypeCode<sup::dto::uint64>()
+{
+  return pvxs::TypeCode::UInt64A;
+}
+
+template <>
+pvxs::TypeCode ArrayTypeCode<sup::dto::float32>()
+{
+  return pvxs::TypeCode::Float32A;
+}
+
+template <>
+pvxs::TypeCode ArrayTypeCode<sup::dto::float64>()
+{
+  return pvxs::TypeCode::Float64A;
+}
+
 }  // namespace utils
 
 }  // namespace epics
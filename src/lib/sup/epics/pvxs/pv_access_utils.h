@@ -21,10 +21,17 @@
 #ifndef SUP_EPICS_PV_ACCESS_UTILS_H_
 #define SUP_EPICS_PV_ACCESS_UTILS_H_
 
+#include "pv_access_task_scheduler.h"
+
+#include <sup/dto/basic_scalar_types.h>
+
 #include <pvxs/client.h>
+#include <pvxs/data.h>
 #include <pvxs/server.h>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace sup
 {
@@ -35,10 +42,84 @@ namespace utils
 
 std::shared_ptr<pvxs::client::Context> GetSharedClientContext();
 
+/**
+ * @brief Register a client context under the given name. Will throw if the name is empty or
+ * already registered.
+ */
+void RegisterClientContext(const std::string& name,
+                           std::shared_ptr<pvxs::client::Context> context);
+
+/**
+ * @brief Check if a client context was registered under the given name. The empty name always
+ * refers to the shared client context.
+ */
+bool HasClientContext(const std::string& name);
+
+/**
+ * @brief Retrieve the client context registered under the given name, or the shared client
+ * context for an empty name. Will throw for unknown names.
+ */
+std::shared_ptr<pvxs::client::Context> GetClientContext(const std::string& name);
+
+/**
+ * @brief Split a comma separated field selection (e.g. "value, timeStamp") into the field paths to
+ * pass to the pvRequest of an operation.
+ */
+std::vector<std::string> GetFieldSelection(const std::string& fields);
+
 std::unique_ptr<pvxs::server::Server> CreateIsolatedServer();
 
 std::unique_ptr<pvxs::server::Server> CreateServerFromEnv();
 
+/**
+ * @brief Retrieve the running server shared by all users of the given group. The server is
+ * created from $EPICS_PVAS* environment variables and started on first use, and stopped when the
+ * last user releases it.
+ */
+std::shared_ptr<pvxs::server::Server> GetSharedServer(const std::string& group);
+
+/**
+ * @brief Retrieve the scheduler for delayed tasks shared by all rate limited server variables and
+ * asynchronous RPC clients. Its worker thread is started on first use and stopped when the last
+ * user releases it.
+ */
+std::shared_ptr<TaskScheduler> GetSharedTaskScheduler();
+
+/**
+ * @brief Retrieve the scheduler shared by all asynchronous RPC clients to cancel and reply their
+ * timed out calls. This keeps slow reply callbacks off the thread of GetSharedTaskScheduler. Its
+ * worker thread is started on first use and stopped when the last user releases it.
+ */
+std::shared_ptr<TaskScheduler> GetSharedRPCTimeoutScheduler();
+
+/**
+ * @brief Retrieve the type code of PVXS scalar arrays with the given element type.
+ */
+template <typename T>
+pvxs::TypeCode ArrayTypeCode();
+template <>
+pvxs::TypeCode ArrayTypeCode<sup::dto::boolean>();
+template <>
+pvxs::TypeCode ArrayTypeCode<sup::dto::int8>();
+template <>
+pvxs::TypeCode ArrayTypeCode<sup::dto::uint8>();
+template <>
+pvxs::TypeCode ArrayTypeCode<sup::dto::int16>();
+template <>
+pvxs::TypeCode ArrayTypeCode<sup::dto::uint16>();
+template <>
+pvxs::TypeCode ArrayTypeCode<sup::dto::int32>();
+template <>
+pvxs::TypeCode ArrayTypeCode<sup::dto::uint32>();
+template <>
+pvxs::TypeCode ArrayTypeCode<sup::dto::int64>();
+template <>
+pvxs::TypeCode ArrayTypeCode<sup::dto::uint64>();
+template <>
+pvxs::TypeCode ArrayTypeCode<sup::dto::float32>();
+template <>
+pvxs::TypeCode ArrayTypeCode<sup::dto::float64>();
+
 }  // namespace utils
 
 }  // namespace epics
@@ -34,7 +34,8 @@ namespace epics
 {
 
 PvAccessRPCClient::PvAccessRPCClient(const PvAccessRPCClientConfig& config)
-  : m_impl{std::make_unique<PvAccessRPCClientImpl>(config, utils::GetSharedClientContext())}
+  : m_impl{std::make_unique<PvAccessRPCClientImpl>(config,
+                                                   utils::GetClientContext(config.context_name))}
 {}
 
 PvAccessRPCClient::PvAccessRPCClient(std::unique_ptr<PvAccessRPCClientImpl>&& impl)
@@ -61,9 +62,26 @@ sup::dto::AnyValue PvAccessRPCClient::operator()(const sup::dto::AnyValue& input
   return m_impl->operator()(input);
 }
 
+std::future<sup::dto::AnyValue> PvAccessRPCClient::CallAsync(const sup::dto::AnyValue& input)
+{
+  return m_impl->CallAsync(input);
+}
+
+std::future<sup::dto::AnyValue> PvAccessRPCClient::CallAsync(const sup::dto::AnyValue& input,
+                                                             double timeout)
+{
+  return m_impl->CallAsync(input, timeout);
+}
+
+void PvAccessRPCClient::CallAsync(const sup::dto::AnyValue& input, double timeout,
+                                  ReplyCallback cb)
+{
+  m_impl->CallAsync(input, timeout, std::move(cb));
+}
+
 PvAccessRPCClientConfig GetDefaultRPCClientConfig(const std::string& service_name)
 {
-  return { service_name, DEFAULT_TIMEOUT_SECONDS };
+  return { service_name, DEFAULT_TIMEOUT_SECONDS, "" };
 }
 
 }  // namespace epics
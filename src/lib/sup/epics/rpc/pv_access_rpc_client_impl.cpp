@@ -22,8 +22,12 @@
 
 #include <sup/epics/pvxs/pv_access_utils.h>
 #include <sup/epics/rpc/pv_access_rpc_utils.h>
+#include <sup/epics/utils/dto_conversion_utils.h>
 
 #include <sup/dto/anyvalue_helper.h>
+#include <sup/protocol/protocol_rpc.h>
+
+#include <chrono>
 
 namespace sup
 {
@@ -34,9 +38,18 @@ PvAccessRPCClientImpl::PvAccessRPCClientImpl(const PvAccessRPCClientConfig& conf
                                              std::shared_ptr<pvxs::client::Context> context)
   : m_config{config}
   , m_context{context}
+  , m_call_mtx{}
+  , m_calls{}
+  , m_next_call_id{0}
+  , m_completed_operations{}
+  , m_scheduler{}
+  , m_timeout_scheduler{}
 {}
 
-PvAccessRPCClientImpl::~PvAccessRPCClientImpl() = default;
+PvAccessRPCClientImpl::~PvAccessRPCClientImpl()
+{
+  CancelCalls();
+}
 
 sup::dto::AnyValue PvAccessRPCClientImpl::operator()(const sup::dto::AnyValue& request)
 {
@@ -47,6 +60,172 @@ sup::dto::AnyValue PvAccessRPCClientImpl::operator()(const sup::dto::AnyValue& r
   return utils::ClientRPCCall(m_context, m_config, request);
 }
 
+std::future<sup::dto::AnyValue> PvAccessRPCClientImpl::CallAsync(
+  const sup::dto::AnyValue& request)
+{
+  return CallAsync(request, m_config.timeout);
+}
+
+std::future<sup::dto::AnyValue> PvAccessRPCClientImpl::CallAsync(
+  const sup::dto::AnyValue& request, double timeout)
+{
+  auto promise = std::make_shared<std::promise<sup::dto::AnyValue>>();
+  auto result = promise->get_future();
+  CallAsync(request, timeout,
+            [promise](const sup::dto::AnyValue& reply) { promise->set_value(reply); });
+  return result;
+}
+
+void PvAccessRPCClientImpl::CallAsync(const sup::dto::AnyValue& request, double timeout,
+                                      PvAccessRPCClient::ReplyCallback cb)
+{
+  if (!cb)
+  {
+    cb = [](const sup::dto::AnyValue&) {};
+  }
+  if (sup::dto::IsEmptyValue(request))
+  {
+    cb({});
+    return;
+  }
+  pvxs::Value pvxs_request;
+  try
+  {
+    pvxs_request = BuildPVXSValue(request);
+  }
+  catch(...)
+  {
+    cb(sup::protocol::utils::CreateRPCReply(sup::protocol::ClientNetworkEncodingError));
+    return;
+  }
+  auto deadline = TaskScheduler::Clock::now()
+                + std::chrono::duration_cast<TaskScheduler::Clock::duration>(
+                    std::chrono::duration<double>(timeout));
+  // Operations of completed calls are released after unlocking.
+  std::vector<std::shared_ptr<pvxs::client::Operation>> completed_operations;
+  std::lock_guard<std::mutex> lk(m_call_mtx);
+  std::swap(completed_operations, m_completed_operations);
+  if (!m_scheduler)
+  {
+    m_scheduler = utils::GetSharedTaskScheduler();
+    m_timeout_scheduler = utils::GetSharedRPCTimeoutScheduler();
+  }
+  auto call_id = m_next_call_id++;
+  auto& pending = m_calls[call_id];
+  pending.callback = std::move(cb);
+  pending.replied = false;
+  pending.operation =
+    m_context->rpc(m_config.service_name, pvxs_request)
+      .result([this, call_id](pvxs::client::Result&& result)
+              {
+                pvxs::Value pvxs_reply;
+                try
+                {
+                  pvxs_reply = result();
+                }
+                catch (const std::exception&)
+                {
+                  OnCallCompleted(
+                    call_id,
+                    sup::protocol::utils::CreateRPCReply(sup::protocol::NotConnected));
+                  return;
+                }
+                OnCallCompleted(call_id, utils::DecodeRPCReply(pvxs_reply));
+              })
+      .exec();
+  auto key = &pending;
+  m_scheduler->Schedule(key, deadline,
+                        [this, key, call_id]
+                        {
+                          m_timeout_scheduler->Schedule(key, TaskScheduler::Clock::now(),
+                                                        [this, call_id]{ OnCallTimeout(call_id); });
+                        });
+}
+
+void PvAccessRPCClientImpl::OnCallCompleted(sup::dto::uint64 call_id,
+                                            const sup::dto::AnyValue& reply)
+{
+  PvAccessRPCClient::ReplyCallback cb;
+  {
+    std::lock_guard<std::mutex> lk(m_call_mtx);
+    auto it = m_calls.find(call_id);
+    if (it == m_calls.end() || it->second.replied)
+    {
+      return;
+    }
+    it->second.replied = true;
+    std::swap(cb, it->second.callback);
+    // When the timeout task already started, the expiration releases the call instead.
+    if (m_scheduler->Remove(&it->second))
+    {
+      m_completed_operations.push_back(std::move(it->second.operation));
+      (void)m_calls.erase(it);
+    }
+  }
+  cb(reply);
+}
+
+void PvAccessRPCClientImpl::OnCallTimeout(sup::dto::uint64 call_id)
+{
+  PvAccessRPCClient::ReplyCallback cb;
+  std::shared_ptr<pvxs::client::Operation> operation;
+  {
+    std::lock_guard<std::mutex> lk(m_call_mtx);
+    auto it = m_calls.find(call_id);
+    if (it == m_calls.end())
+    {
+      return;
+    }
+    std::swap(operation, it->second.operation);
+    if (it->second.replied)
+    {
+      (void)m_calls.erase(it);
+      return;
+    }
+    it->second.replied = true;
+    std::swap(cb, it->second.callback);
+  }
+  // Cancelling waits for a running result callback, which then finds the call already replied.
+  (void)operation->cancel();
+  operation.reset();
+  {
+    std::lock_guard<std::mutex> lk(m_call_mtx);
+    (void)m_calls.erase(call_id);
+  }
+  cb(sup::protocol::utils::CreateRPCReply(sup::protocol::NotConnected));
+}
+
+void PvAccessRPCClientImpl::CancelCalls()
+{
+  std::map<sup::dto::uint64, PendingCall> calls;
+  {
+    std::lock_guard<std::mutex> lk(m_call_mtx);
+    std::swap(calls, m_calls);
+  }
+  // Cancelling a timeout task waits for it if it is running. Its expiration, which it may have
+  // handed to the timeout scheduler, is cancelled afterwards.
+  for (auto& call : calls)
+  {
+    m_scheduler->Cancel(&call.second);
+    m_timeout_scheduler->Cancel(&call.second);
+  }
+  for (auto& call : calls)
+  {
+    if (call.second.operation)
+    {
+      (void)call.second.operation->cancel();
+    }
+  }
+  for (auto& call : calls)
+  {
+    if (!call.second.replied)
+    {
+      call.second.callback(
+        sup::protocol::utils::CreateRPCReply(sup::protocol::NotConnected));
+    }
+  }
+}
+
 }  // namespace epics
 
 }  // namespace sup
@@ -21,13 +21,18 @@
 #ifndef SUP_EPICS_PV_ACCESS_RPC_CLIENT_IMPL_H_
 #define SUP_EPICS_PV_ACCESS_RPC_CLIENT_IMPL_H_
 
-#include <sup/epics/pv_access_rpc_client_config.h>
+#include <sup/epics/pv_access_rpc_client.h>
+#include <sup/epics/pvxs/pv_access_task_scheduler.h>
 
 #include <sup/protocol/protocol.h>
 
 #include <pvxs/client.h>
 
+#include <future>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 namespace sup
 {
@@ -47,9 +52,34 @@ public:
   ~PvAccessRPCClientImpl();
 
   sup::dto::AnyValue operator()(const sup::dto::AnyValue& request);
+
+  std::future<sup::dto::AnyValue> CallAsync(const sup::dto::AnyValue& request);
+  std::future<sup::dto::AnyValue> CallAsync(const sup::dto::AnyValue& request, double timeout);
+  void CallAsync(const sup::dto::AnyValue& request, double timeout,
+                 PvAccessRPCClient::ReplyCallback cb);
+
 private:
+  //! An RPC call in flight. Its address is the key of its timeout task in both schedulers, so it
+  //! is only released when that task was removed or has finished.
+  struct PendingCall
+  {
+    std::shared_ptr<pvxs::client::Operation> operation;
+    PvAccessRPCClient::ReplyCallback callback;
+    bool replied;
+  };
+  void OnCallCompleted(sup::dto::uint64 call_id, const sup::dto::AnyValue& reply);
+  void OnCallTimeout(sup::dto::uint64 call_id);
+  void CancelCalls();
   PvAccessRPCClientConfig m_config;
   std::shared_ptr<pvxs::client::Context> m_context;
+  std::mutex m_call_mtx;
+  std::map<sup::dto::uint64, PendingCall> m_calls;
+  sup::dto::uint64 m_next_call_id;
+  //! Operations of completed calls, which cannot be released from their own result callback.
+  std::vector<std::shared_ptr<pvxs::client::Operation>> m_completed_operations;
+  std::shared_ptr<TaskScheduler> m_scheduler;  //!< Only acquired on the first asynchronous call
+  //! Cancels and replies timed out calls, so they do not block the shared scheduler.
+  std::shared_ptr<TaskScheduler> m_timeout_scheduler;
 };
 
 }  // namespace epics
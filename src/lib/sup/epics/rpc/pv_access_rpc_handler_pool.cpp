@@ -0,0 +1,92 @@
+/******************************************************************************
+ *
+ * Project       : Supervision and automation system EPICS interface
+ *
+ * Description   : Library of SUP components for EPICS network protocol
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "pv_access_rpc_handler_pool.h"
+
+#include <utility>
+
+namespace sup
+{
+namespace epics
+{
+
+RPCHandlerPool::RPCHandlerPool(sup::dto::uint32 n_threads, sup::dto::uint32 max_pending)
+  : m_mtx{}
+  , m_cv{}
+  , m_queue{}
+  , m_max_pending{max_pending}
+  , m_halt{false}
+  , m_threads{}
+{
+  for (sup::dto::uint32 i = 0; i < n_threads; ++i)
+  {
+    m_threads.emplace_back(&RPCHandlerPool::Run, this);
+  }
+}
+
+RPCHandlerPool::~RPCHandlerPool()
+{
+  {
+    std::lock_guard<std::mutex> lk{m_mtx};
+    m_halt = true;
+    m_queue.clear();
+  }
+  m_cv.notify_all();
+  for (auto& thread : m_threads)
+  {
+    thread.join();
+  }
+}
+
+bool RPCHandlerPool::Submit(Task task)
+{
+  {
+    std::lock_guard<std::mutex> lk{m_mtx};
+    if (m_max_pending > 0 && m_queue.size() >= m_max_pending)
+    {
+      return false;
+    }
+    m_queue.push_back(std::move(task));
+  }
+  m_cv.notify_one();
+  return true;
+}
+
+void RPCHandlerPool::Run()
+{
+  std::unique_lock<std::mutex> lk{m_mtx};
+  while (true)
+  {
+    m_cv.wait(lk, [this]{ return m_halt || !m_queue.empty(); });
+    if (m_halt)
+    {
+      return;
+    }
+    auto task = std::move(m_queue.front());
+    m_queue.pop_front();
+    lk.unlock();
+    task();
+    lk.lock();
+  }
+}
+
+}  // namespace epics
+
+}  // namespace sup
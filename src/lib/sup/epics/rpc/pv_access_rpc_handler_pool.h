@@ -0,0 +1,77 @@
+/******************************************************************************
+ *
+ * Project       : Supervision and automation system EPICS interface
+ *
+ * Description   : Library of SUP components for EPICS network protocol
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_EPICS_PV_ACCESS_RPC_HANDLER_POOL_H_
+#define SUP_EPICS_PV_ACCESS_RPC_HANDLER_POOL_H_
+
+#include <sup/dto/basic_scalar_types.h>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sup
+{
+namespace epics
+{
+
+//! Fixed size pool of threads that handle the requests of a PvAccessRPCServer.
+//!
+//! @details Tasks are run in the order of their submission. The number of threads is the maximum
+//! number of tasks that run concurrently. The number of tasks that wait for a free thread can be
+//! limited. Tasks that did not start yet when the pool is destroyed are discarded.
+
+class RPCHandlerPool
+{
+public:
+  using Task = std::function<void()>;
+
+  //! Creates a pool with the given number of threads. A maximum number of pending tasks of zero
+  //! means no limit.
+  RPCHandlerPool(sup::dto::uint32 n_threads, sup::dto::uint32 max_pending);
+  ~RPCHandlerPool();
+
+  RPCHandlerPool(const RPCHandlerPool&) = delete;
+  RPCHandlerPool& operator=(const RPCHandlerPool&) = delete;
+  RPCHandlerPool(RPCHandlerPool&&) = delete;
+  RPCHandlerPool& operator=(RPCHandlerPool&&) = delete;
+
+  //! Queues the task to be run by the first available thread. Returns false, without queueing the
+  //! task, when the maximum number of pending tasks is reached.
+  bool Submit(Task task);
+
+private:
+  void Run();
+  std::mutex m_mtx;
+  std::condition_variable m_cv;
+  std::deque<Task> m_queue;
+  const sup::dto::uint32 m_max_pending;
+  bool m_halt;
+  std::vector<std::thread> m_threads;
+};
+
+}  // namespace epics
+
+}  // namespace sup
+
+#endif  // SUP_EPICS_PV_ACCESS_RPC_HANDLER_POOL_H_
@@ -49,9 +49,14 @@ PvAccessRPCClient PvAccessRPCServer::CreateClient(const PvAccessRPCClientConfig&
   return PvAccessRPCClient{std::move(client_impl)};
 }
 
+PvAccessRPCServerCounters PvAccessRPCServer::GetCounters() const
+{
+  return m_impl->GetCounters();
+}
+
 PvAccessRPCServerConfig GetDefaultRPCServerConfig(const std::string& service_name)
 {
-  return { service_name };
+  return { service_name, 0, 0, 0 };
 }
 
 }  // namespace epics
@@ -24,7 +24,10 @@
 #include <sup/epics/rpc/pv_access_rpc_utils.h>
 #include <sup/epics/utils/dto_conversion_utils.h>
 
+#include <sup/epics/pv_access_rpc_server.h>
+
 #include <sup/dto/anyvalue.h>
+#include <sup/protocol/protocol_rpc.h>
 
 #include <pvxs/sharedpv.h>
 
@@ -39,17 +42,28 @@ PvAccessRPCServerImpl::PvAccessRPCServerImpl(std::unique_ptr<pvxs::server::Serve
   , m_config{config}
   , m_handler{handler}
   , m_client_context{}
+  , m_handler_pool{}
+  , m_admission_mtx{}
+  , m_in_flight{0}
+  , m_counters{}
 {
   if (!m_server)
   {
     throw std::runtime_error("PvAccessRPCServer created without server or handler");
   }
+  if (m_config.handler_threads > 0)
+  {
+    m_handler_pool = std::make_unique<RPCHandlerPool>(m_config.handler_threads,
+                                                      m_config.max_pending_requests);
+  }
   Initialise();
 }
 
 PvAccessRPCServerImpl::~PvAccessRPCServerImpl()
 {
   (void)m_server->stop();
+  // Wait for running requests to finish before the handler can be destroyed.
+  m_handler_pool.reset();
 }
 
 std::shared_ptr<pvxs::client::Context> PvAccessRPCServerImpl::GetClientContext()
@@ -61,6 +75,12 @@ std::shared_ptr<pvxs::client::Context> PvAccessRPCServerImpl::GetClientContext()
   return m_client_context;
 }
 
+PvAccessRPCServerCounters PvAccessRPCServerImpl::GetCounters() const
+{
+  std::lock_guard<std::mutex> lk{m_admission_mtx};
+  return m_counters;
+}
+
 void PvAccessRPCServerImpl::Initialise()
 {
   auto shared_pv = pvxs::server::SharedPV::buildMailbox();
@@ -70,13 +90,75 @@ void PvAccessRPCServerImpl::Initialise()
     [this](pvxs::server::SharedPV&, std::unique_ptr<pvxs::server::ExecOp>&& op,
            pvxs::Value&& pvxs_request)
     {
-      auto pvxs_reply = utils::HandleRPCCall(m_handler, pvxs_request);
-      op->reply(pvxs_reply);
+      if (!ReserveRequest())
+      {
+        RejectRequest(*op);
+        return;
+      }
+      if (!m_handler_pool)
+      {
+        AcceptRequest();
+        auto pvxs_reply = utils::HandleRPCCall(m_handler, pvxs_request);
+        op->reply(pvxs_reply);
+        ReleaseRequest();
+        return;
+      }
+      // The operation is retained by the task, which replies from one of the pool's threads.
+      std::shared_ptr<pvxs::server::ExecOp> shared_op{std::move(op)};
+      auto submitted = m_handler_pool->Submit(
+        [this, shared_op, pvxs_request]()
+        {
+          auto pvxs_reply = utils::HandleRPCCall(m_handler, pvxs_request);
+          shared_op->reply(pvxs_reply);
+          ReleaseRequest();
+        });
+      if (!submitted)
+      {
+        ReleaseRequest();
+        RejectRequest(*shared_op);
+        return;
+      }
+      AcceptRequest();
     }
   );
   (void)m_server->start();
 }
 
+//! Counts the request as in flight, unless the maximum number of requests in flight is reached.
+bool PvAccessRPCServerImpl::ReserveRequest()
+{
+  std::lock_guard<std::mutex> lk{m_admission_mtx};
+  if (m_config.max_in_flight_requests > 0 && m_in_flight >= m_config.max_in_flight_requests)
+  {
+    return false;
+  }
+  ++m_in_flight;
+  return true;
+}
+
+//! Counts the request as accepted, once it is handled or queued for one of the handler threads.
+void PvAccessRPCServerImpl::AcceptRequest()
+{
+  std::lock_guard<std::mutex> lk{m_admission_mtx};
+  ++m_counters.accepted;
+}
+
+void PvAccessRPCServerImpl::ReleaseRequest()
+{
+  std::lock_guard<std::mutex> lk{m_admission_mtx};
+  --m_in_flight;
+}
+
+//! Replies immediately to a request that cannot be handled because of the server's load.
+void PvAccessRPCServerImpl::RejectRequest(pvxs::server::ExecOp& op)
+{
+  {
+    std::lock_guard<std::mutex> lk{m_admission_mtx};
+    ++m_counters.rejected;
+  }
+  op.reply(BuildPVXSValue(sup::protocol::utils::CreateRPCReply(ServerBusy)));
+}
+
 std::unique_ptr<PvAccessRPCServerImpl> CreateIsolatedRPCServerImpl(
   const PvAccessRPCServerConfig& config, sup::dto::AnyFunctor& handler)
 {
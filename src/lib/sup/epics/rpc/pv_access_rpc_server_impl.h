@@ -22,6 +22,7 @@
 #define SUP_EPICS_PV_ACCESS_RPC_SERVER_IMPL_H_
 
 #include <sup/epics/pv_access_rpc_server_config.h>
+#include <sup/epics/rpc/pv_access_rpc_handler_pool.h>
 
 #include <sup/dto/any_functor.h>
 
@@ -29,6 +30,7 @@
 #include <pvxs/server.h>
 
 #include <memory>
+#include <mutex>
 
 namespace sup
 {
@@ -49,12 +51,22 @@ public:
 
   std::shared_ptr<pvxs::client::Context> GetClientContext();
 
+  PvAccessRPCServerCounters GetCounters() const;
+
 private:
   void Initialise();
+  bool ReserveRequest();
+  void AcceptRequest();
+  void ReleaseRequest();
+  void RejectRequest(pvxs::server::ExecOp& op);
   std::unique_ptr<pvxs::server::Server> m_server;
   PvAccessRPCServerConfig m_config;
   sup::dto::AnyFunctor& m_handler;
   std::shared_ptr<pvxs::client::Context> m_client_context;
+  std::unique_ptr<RPCHandlerPool> m_handler_pool;
+  mutable std::mutex m_admission_mtx;
+  sup::dto::uint32 m_in_flight;
+  PvAccessRPCServerCounters m_counters;
 };
 
 std::unique_ptr<PvAccessRPCServerImpl> CreateIsolatedRPCServerImpl(
@@ -54,6 +54,11 @@ sup::dto::AnyValue ClientRPCCall(std::shared_ptr<pvxs::client::Context> context,
   {
     return sup::protocol::utils::CreateRPCReply(sup::protocol::NotConnected);
   }
+  return DecodeRPCReply(pvxs_reply);
+}
+
+sup::dto::AnyValue DecodeRPCReply(const pvxs::Value& pvxs_reply)
+{
   if (!pvxs_reply)
   {
     return sup::protocol::utils::CreateRPCReply(sup::protocol::ClientNetworkDecodingError);
@@ -41,6 +41,8 @@ sup::dto::AnyValue ClientRPCCall(std::shared_ptr<pvxs::client::Context> context,
                                  const PvAccessRPCClientConfig& config,
                                  const sup::dto::AnyValue& request);
 
+sup::dto::AnyValue DecodeRPCReply(const pvxs::Value& pvxs_reply);
+
 pvxs::Value HandleRPCCall(sup::dto::AnyFunctor& handler, const pvxs::Value& pvxs_request);
 
 }  // namespace utils
@@ -0,0 +1,211 @@
+/******************************************************************************
+ *
+ * Project       : Supervision and automation system EPICS interface
+ *
+ * Description   : Library of SUP components for EPICS network protocol
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "anyvalue_conversion_plan.h"
+
+#include <pvxs/data.h>
+#include <sup/dto/anyvalue.h>
+#include <sup/dto/anyvalue_helper.h>
+#include <sup/epics/utils/dto_conversion_utils.h>
+#include <sup/epics/utils/dto_scalar_conversion_utils.h>
+#include <sup/epics/utils/dto_typecode_conversion_utils.h>
+#include <sup/epics/utils/pvxs_utils.h>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+enum class FieldKind
+{
+  kStruct,
+  kScalar,
+  kScalarArray,
+  kComposite,
+  kSkipped
+};
+
+FieldKind GetFieldKind(const pvxs::Value& field);
+
+bool IsSkippedField(const std::string& path, const std::vector<std::string>& skipped_fields);
+}  // unnamed namespace
+
+namespace sup
+{
+namespace epics
+{
+
+struct AnyValueConversionPlan::AnyValueConversionPlanImpl
+{
+  struct Entry
+  {
+    FieldKind m_kind;
+    ::pvxs::TypeCode m_type_code;
+    sup::dto::AnyValue* m_target;
+  };
+
+  std::vector<Entry> m_entries;
+  bool m_is_compiled{false};
+
+  bool ConvertField(const pvxs::Value& field, const Entry& entry) const;
+};
+
+AnyValueConversionPlan::AnyValueConversionPlan()
+  : p_impl(std::make_unique<AnyValueConversionPlanImpl>())
+{}
+
+AnyValueConversionPlan::~AnyValueConversionPlan() = default;
+
+bool AnyValueConversionPlan::Compile(const pvxs::Value& pvxs_value, dto::AnyValue& any_value,
+                                     const std::vector<std::string>& skipped_fields)
+{
+  Reset();
+  if (!IsStruct(pvxs_value) || !sup::dto::IsStructValue(any_value))
+  {
+    return false;
+  }
+  std::vector<AnyValueConversionPlanImpl::Entry> entries;
+  for (auto field : pvxs_value.iall())
+  {
+    // Field names are only resolved here, applying the plan relies on the field order.
+    auto path = pvxs_value.nameOf(field);
+    if (IsSkippedField(path, skipped_fields))
+    {
+      entries.push_back({FieldKind::kSkipped, field.type(), nullptr});
+      continue;
+    }
+    if (!any_value.HasField(path))
+    {
+      return false;
+    }
+    auto& member = any_value[path];
+    auto kind = GetFieldKind(field);
+    if (kind == FieldKind::kStruct && !sup::dto::IsStructValue(member))
+    {
+      return false;
+    }
+    if (kind == FieldKind::kScalar && member.GetTypeCode() != GetAnyTypeCode(field.type()))
+    {
+      return false;
+    }
+    entries.push_back({kind, field.type(), &member});
+  }
+  p_impl->m_entries = std::move(entries);
+  p_impl->m_is_compiled = true;
+  return true;
+}
+
+bool AnyValueConversionPlan::IsCompiled() const
+{
+  return p_impl->m_is_compiled;
+}
+
+void AnyValueConversionPlan::Reset()
+{
+  p_impl->m_entries.clear();
+  p_impl->m_is_compiled = false;
+}
+
+bool AnyValueConversionPlan::Apply(const pvxs::Value& pvxs_value, bool marked_only) const
+{
+  if (!IsCompiled() || !IsStruct(pvxs_value))
+  {
+    return false;
+  }
+  const auto& entries = p_impl->m_entries;
+  std::size_t index = 0;
+  for (auto field : pvxs_value.iall())
+  {
+    if (index >= entries.size() || field.type() != entries[index].m_type_code)
+    {
+      return false;
+    }
+    const auto& entry = entries[index];
+    ++index;
+    // A field also changed when one of its parent structs was marked as a whole.
+    if (marked_only && !field.isMarked(true, false))
+    {
+      continue;
+    }
+    if (!p_impl->ConvertField(field, entry))
+    {
+      return false;
+    }
+  }
+  return index == entries.size();
+}
+
+bool AnyValueConversionPlan::AnyValueConversionPlanImpl::ConvertField(const pvxs::Value& field,
+                                                                      const Entry& entry) const
+{
+  if (entry.m_kind == FieldKind::kStruct || entry.m_kind == FieldKind::kSkipped)
+  {
+    // Struct members have their own entries.
+    return true;
+  }
+  if (entry.m_kind == FieldKind::kScalar)
+  {
+    AssignPVXSValueToAnyValueScalar(field, *entry.m_target);
+    return true;
+  }
+  if (entry.m_kind == FieldKind::kScalarArray)
+  {
+    return sup::dto::TryAssignIfEmptyOrConvert(*entry.m_target, GetAnyValueFromScalarArray(field));
+  }
+  return sup::dto::TryAssignIfEmptyOrConvert(*entry.m_target, BuildAnyValue(field));
+}
+
+}  // namespace epics
+
+}  // namespace sup
+
+namespace
+{
+FieldKind GetFieldKind(const pvxs::Value& field)
+{
+  if (sup::epics::IsStruct(field))
+  {
+    return FieldKind::kStruct;
+  }
+  if (sup::epics::IsScalar(field))
+  {
+    return FieldKind::kScalar;
+  }
+  if (sup::epics::IsScalarArray(field))
+  {
+    return FieldKind::kScalarArray;
+  }
+  return FieldKind::kComposite;
+}
+
+bool IsSkippedField(const std::string& path, const std::vector<std::string>& skipped_fields)
+{
+  for (const auto& skipped : skipped_fields)
+  {
+    if (path.compare(0, skipped.size(), skipped) == 0
+        && (path.size() == skipped.size() || path[skipped.size()] == '.'))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // unnamed namespace
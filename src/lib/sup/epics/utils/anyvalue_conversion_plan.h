@@ -0,0 +1,81 @@
+/******************************************************************************
+ *
+ * Project       : Supervision and automation system EPICS interface
+ *
+ * Description   : Library of SUP components for EPICS network protocol
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_EPICS_UTILS_ANYVALUE_CONVERSION_PLAN_H_
+#define SUP_EPICS_UTILS_ANYVALUE_CONVERSION_PLAN_H_
+
+#include <sup/epics/utils/dto_types_fwd.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sup
+{
+namespace epics
+{
+
+//! Flat conversion plan to repeatedly update an AnyValue from PVXS struct values of a fixed type.
+//!
+//! @details The plan is compiled once from a PVXS value and an AnyValue with the same layout. It
+//! holds one entry per PVXS field, in the depth-first order of pvxs::Value::iall(), with a direct
+//! reference to the corresponding AnyValue member. Applying the plan then only walks the PVXS
+//! fields and assigns the leaves, without looking up field names or composing new values.
+//!
+//! @note The compiled AnyValue has to outlive the plan and must not be reassigned as a whole while
+//! the plan is in use, since that may invalidate the references to its members.
+
+class AnyValueConversionPlan
+{
+public:
+  AnyValueConversionPlan();
+  ~AnyValueConversionPlan();
+
+  AnyValueConversionPlan(const AnyValueConversionPlan&) = delete;
+  AnyValueConversionPlan& operator=(const AnyValueConversionPlan&) = delete;
+
+  //! Compiles the plan for the given PVXS struct value and the AnyValue that mirrors it. Returns
+  //! false (and leaves the plan empty) if the AnyValue does not have the layout of the PVXS value.
+  //! The PVXS fields with a path in `skipped_fields` (and their members) are not converted and do
+  //! not need to exist in the AnyValue.
+  bool Compile(const ::pvxs::Value& pvxs_value, ::sup::dto::AnyValue& any_value,
+               const std::vector<std::string>& skipped_fields = {});
+
+  //! Returns true if the plan was successfully compiled.
+  bool IsCompiled() const;
+
+  //! Discards the compiled plan.
+  void Reset();
+
+  //! Updates the compiled AnyValue from the given PVXS value. When `marked_only` is true, only the
+  //! fields that are marked as changed are converted. Returns false if the PVXS value does not
+  //! have the compiled type; the AnyValue may then be partially updated.
+  bool Apply(const ::pvxs::Value& pvxs_value, bool marked_only) const;
+
+private:
+  struct AnyValueConversionPlanImpl;
+  std::unique_ptr<AnyValueConversionPlanImpl> p_impl;
+};
+
+}  // namespace epics
+
+}  // namespace sup
+
+#endif  // SUP_EPICS_UTILS_ANYVALUE_CONVERSION_PLAN_H_
@@ -83,6 +83,32 @@ template <typename T>
   return result;
 }
 
+//! Compares scalar value of PVXS value with AnyValue without converting them.
+template <typename T>
+bool IsEqualToPVXSScalar(const pvxs::Value& pvxs_value, const sup::dto::AnyValue& any_value)
+{
+  return pvxs_value.as<sup::epics::DTOToPVXSScalar_t<T>>() == any_value.As<T>();
+}
+
+//! Compares array elements of PVXS value with AnyValue in place, without copying the PVXS buffer.
+template <typename T>
+bool IsEqualToPVXSScalarArray(const pvxs::Value& pvxs_value, const sup::dto::AnyValue& any_value)
+{
+  auto data = pvxs_value.as<::pvxs::shared_array<const sup::epics::DTOToPVXSScalar_t<T>>>();
+  if (data.size() != any_value.NumberOfElements())
+  {
+    return false;
+  }
+  for (size_t i = 0; i < data.size(); ++i)
+  {
+    if (data[i] != any_value[i].As<T>())
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
 using pvxs_function_t =
     std::function<void(const sup::dto::AnyValue& anyvalue, pvxs::Value& pvxs_value)>;
 
@@ -155,6 +181,39 @@ const std::map<sup::dto::TypeCode, create_anyvalue_t> kCreateAnyValueScalarArray
     {sup::dto::TypeCode::Float64, CreateAnyValueScalarArray<sup::dto::float64>},
     {sup::dto::TypeCode::String, CreateAnyValueScalarArray<std::string>}};
 
+using compare_function_t =
+    std::function<bool(const pvxs::Value& pvxs_value, const sup::dto::AnyValue& anyvalue)>;
+
+//! Correspondance of AnyValue type code to function to compare scalars.
+const std::map<sup::dto::TypeCode, compare_function_t> kIsEqualScalarMap = {
+    {sup::dto::TypeCode::Bool, IsEqualToPVXSScalar<sup::dto::boolean>},
+    {sup::dto::TypeCode::Int8, IsEqualToPVXSScalar<sup::dto::int8>},
+    {sup::dto::TypeCode::UInt8, IsEqualToPVXSScalar<sup::dto::uint8>},
+    {sup::dto::TypeCode::Int16, IsEqualToPVXSScalar<sup::dto::int16>},
+    {sup::dto::TypeCode::UInt16, IsEqualToPVXSScalar<sup::dto::uint16>},
+    {sup::dto::TypeCode::Int32, IsEqualToPVXSScalar<sup::dto::int32>},
+    {sup::dto::TypeCode::UInt32, IsEqualToPVXSScalar<sup::dto::uint32>},
+    {sup::dto::TypeCode::Int64, IsEqualToPVXSScalar<sup::dto::int64>},
+    {sup::dto::TypeCode::UInt64, IsEqualToPVXSScalar<sup::dto::uint64>},
+    {sup::dto::TypeCode::Float32, IsEqualToPVXSScalar<sup::dto::float32>},
+    {sup::dto::TypeCode::Float64, IsEqualToPVXSScalar<sup::dto::float64>},
+    {sup::dto::TypeCode::String, IsEqualToPVXSScalar<std::string>}};
+
+//! Correspondance of AnyValue type code to function to compare scalar arrays.
+const std::map<sup::dto::TypeCode, compare_function_t> kIsEqualScalarArrayMap = {
+    {sup::dto::TypeCode::Bool, IsEqualToPVXSScalarArray<sup::dto::boolean>},
+    {sup::dto::TypeCode::Int8, IsEqualToPVXSScalarArray<sup::dto::int8>},
+    {sup::dto::TypeCode::UInt8, IsEqualToPVXSScalarArray<sup::dto::uint8>},
+    {sup::dto::TypeCode::Int16, IsEqualToPVXSScalarArray<sup::dto::int16>},
+    {sup::dto::TypeCode::UInt16, IsEqualToPVXSScalarArray<sup::dto::uint16>},
+    {sup::dto::TypeCode::Int32, IsEqualToPVXSScalarArray<sup::dto::int32>},
+    {sup::dto::TypeCode::UInt32, IsEqualToPVXSScalarArray<sup::dto::uint32>},
+    {sup::dto::TypeCode::Int64, IsEqualToPVXSScalarArray<sup::dto::int64>},
+    {sup::dto::TypeCode::UInt64, IsEqualToPVXSScalarArray<sup::dto::uint64>},
+    {sup::dto::TypeCode::Float32, IsEqualToPVXSScalarArray<sup::dto::float32>},
+    {sup::dto::TypeCode::Float64, IsEqualToPVXSScalarArray<sup::dto::float64>},
+    {sup::dto::TypeCode::String, IsEqualToPVXSScalarArray<std::string>}};
+
 //! Finds pvxs::TypeCode corresponding to the given AnyType. Use provided container.
 template <typename T>
 typename T::mapped_type FindContentForType(const T& container, sup::dto::TypeCode type_code)
@@ -256,6 +315,23 @@ dto::AnyValue GetAnyValueFromScalarArray(const pvxs::Value& pvxs_value)
   return assign_func(pvxs_value);
 }
 
+bool IsEqualScalar(const pvxs::Value& pvxs_value, const dto::AnyValue& any_value)
+{
+  auto compare_func = FindContentForType(kIsEqualScalarMap, any_value.GetTypeCode());
+  return compare_func(pvxs_value, any_value);
+}
+
+bool IsEqualScalarArray(const pvxs::Value& pvxs_value, const dto::AnyValue& any_value)
+{
+  if (!sup::dto::IsArrayValue(any_value))
+  {
+    throw std::runtime_error("Method is intended for array like AnyValues");
+  }
+  auto element_type_code = any_value.GetType().ElementType().GetTypeCode();
+  auto compare_func = FindContentForType(kIsEqualScalarArrayMap, element_type_code);
+  return compare_func(pvxs_value, any_value);
+}
+
 }  // namespace epics
 
 }  // namespace sup
@@ -57,6 +57,14 @@ void AssignPVXSValueToAnyValueScalar(const ::pvxs::Value& pvxs_value,
 //! Returns AnyValue constructed and initialised from PVXS Value containing scalar array.
 ::sup::dto::AnyValue GetAnyValueFromScalarArray(const ::pvxs::Value& pvxs_value);
 
+//! Returns true if the scalar-like PVXS value equals the AnyValue, without converting them.
+//! It is expected that AnyValue type matches PVXS type.
+bool IsEqualScalar(const ::pvxs::Value& pvxs_value, const ::sup::dto::AnyValue& any_value);
+
+//! Returns true if the PVXS scalar array has the same elements as the array-like AnyValue. The
+//! elements are compared in place. It is expected that AnyValue element type matches PVXS type.
+bool IsEqualScalarArray(const ::pvxs::Value& pvxs_value, const ::sup::dto::AnyValue& any_value);
+
 }  // namespace epics
 
 }  // namespace sup
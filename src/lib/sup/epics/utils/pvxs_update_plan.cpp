@@ -0,0 +1,153 @@
+/******************************************************************************
+ *
+ * Project       : Supervision and automation system EPICS interface
+ *
+ * Description   : Library of SUP components for EPICS network protocol
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "pvxs_update_plan.h"
+
+#include <pvxs/data.h>
+#include <sup/dto/anytype.h>
+#include <sup/dto/anyvalue.h>
+#include <sup/dto/anyvalue_helper.h>
+#include <sup/epics/utils/dto_scalar_conversion_utils.h>
+#include <sup/epics/utils/dto_typecode_conversion_utils.h>
+#include <sup/epics/utils/pvxs_utils.h>
+
+#include <vector>
+
+namespace sup
+{
+namespace epics
+{
+
+struct PvxsUpdatePlan::PvxsUpdatePlanImpl
+{
+  struct Entry
+  {
+    bool m_is_array;
+    ::pvxs::Value m_field;
+    const sup::dto::AnyValue* m_source;
+  };
+
+  ::pvxs::Value m_pvxs_value;
+  std::vector<Entry> m_entries;
+  bool m_is_compiled{false};
+  bool m_is_unsupported{false};
+};
+
+PvxsUpdatePlan::PvxsUpdatePlan()
+  : p_impl(std::make_unique<PvxsUpdatePlanImpl>())
+{}
+
+PvxsUpdatePlan::~PvxsUpdatePlan() = default;
+
+bool PvxsUpdatePlan::Compile(pvxs::Value& pvxs_value, const dto::AnyValue& any_value)
+{
+  Reset();
+  p_impl->m_is_unsupported = !CompileEntries(pvxs_value, any_value);
+  return !p_impl->m_is_unsupported;
+}
+
+bool PvxsUpdatePlan::CompileEntries(pvxs::Value& pvxs_value, const dto::AnyValue& any_value)
+{
+  if (!IsStruct(pvxs_value) || !sup::dto::IsStructValue(any_value))
+  {
+    return false;
+  }
+  std::vector<PvxsUpdatePlanImpl::Entry> entries;
+  for (auto field : pvxs_value.iall())
+  {
+    if (IsStruct(field))
+    {
+      // Only leaves are assigned, struct fields are marked through their members.
+      continue;
+    }
+    auto path = pvxs_value.nameOf(field);
+    if (!any_value.HasField(path))
+    {
+      return false;
+    }
+    const auto& member = any_value[path];
+    // Scalar types have to match exactly, e.g. char8 members are published as uint8 fields and
+    // would be reported as changed on every update.
+    const auto pvxs_type_code = GetAnyTypeCode(field.type());
+    if (IsScalar(field) && member.GetTypeCode() == pvxs_type_code)
+    {
+      entries.push_back({false, field, &member});
+    }
+    else if (IsScalarArray(field) && sup::dto::IsArrayValue(member)
+             && member.GetType().ElementType().GetTypeCode() == pvxs_type_code)
+    {
+      entries.push_back({true, field, &member});
+    }
+    else
+    {
+      return false;
+    }
+  }
+  p_impl->m_pvxs_value = pvxs_value;
+  p_impl->m_entries = std::move(entries);
+  p_impl->m_is_compiled = true;
+  return true;
+}
+
+bool PvxsUpdatePlan::IsCompiled() const
+{
+  return p_impl->m_is_compiled;
+}
+
+bool PvxsUpdatePlan::IsUnsupported() const
+{
+  return p_impl->m_is_unsupported;
+}
+
+void PvxsUpdatePlan::Reset()
+{
+  p_impl->m_pvxs_value = ::pvxs::Value{};
+  p_impl->m_entries.clear();
+  p_impl->m_is_compiled = false;
+  p_impl->m_is_unsupported = false;
+}
+
+bool PvxsUpdatePlan::Apply() const
+{
+  if (!IsCompiled())
+  {
+    return false;
+  }
+  (void)p_impl->m_pvxs_value.unmark(false, true);
+  for (auto& entry : p_impl->m_entries)
+  {
+    if (entry.m_is_array)
+    {
+      if (!IsEqualScalarArray(entry.m_field, *entry.m_source))
+      {
+        AssignAnyValueToPVXSValueScalarArray(*entry.m_source, entry.m_field);
+      }
+    }
+    else if (!IsEqualScalar(entry.m_field, *entry.m_source))
+    {
+      AssignAnyValueToPVXSValueScalar(*entry.m_source, entry.m_field);
+    }
+  }
+  return true;
+}
+
+}  // namespace epics
+
+}  // namespace sup
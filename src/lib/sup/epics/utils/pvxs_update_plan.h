@@ -0,0 +1,82 @@
+/******************************************************************************
+ *
+ * Project       : Supervision and automation system EPICS interface
+ *
+ * Description   : Library of SUP components for EPICS network protocol
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef SUP_EPICS_UTILS_PVXS_UPDATE_PLAN_H_
+#define SUP_EPICS_UTILS_PVXS_UPDATE_PLAN_H_
+
+#include <sup/epics/utils/dto_types_fwd.h>
+
+#include <memory>
+
+namespace sup
+{
+namespace epics
+{
+
+//! Flat plan to repeatedly update a PVXS struct value in place from an AnyValue of a fixed type.
+//!
+//! @details The plan is the counterpart of AnyValueConversionPlan. It is compiled once from a PVXS
+//! value and the AnyValue it was built from. It holds one entry per leaf field, in the depth-first
+//! order of pvxs::Value::iall(), with a reference to the PVXS field and to the corresponding
+//! AnyValue member. Applying the plan unmarks the PVXS value and assigns (and thereby marks) only
+//! the leaves whose value differs from the AnyValue, so that posting the PVXS value sends a delta.
+//!
+//! @note The compiled AnyValue has to outlive the plan and must not be reassigned as a whole while
+//! the plan is in use, since that may invalidate the references to its members. Structures with
+//! arrays of structs are not supported.
+
+class PvxsUpdatePlan
+{
+public:
+  PvxsUpdatePlan();
+  ~PvxsUpdatePlan();
+
+  PvxsUpdatePlan(const PvxsUpdatePlan&) = delete;
+  PvxsUpdatePlan& operator=(const PvxsUpdatePlan&) = delete;
+
+  //! Compiles the plan for the given PVXS struct value and the AnyValue that it mirrors. Returns
+  //! false (and leaves the plan empty) if the AnyValue does not have the layout of the PVXS value.
+  bool Compile(::pvxs::Value& pvxs_value, const ::sup::dto::AnyValue& any_value);
+
+  //! Returns true if the plan was successfully compiled.
+  bool IsCompiled() const;
+
+  //! Returns true if the last compilation failed because the layout is not supported. This state
+  //! is kept until the plan is reset, so callers can fall back without compiling again.
+  bool IsUnsupported() const;
+
+  //! Discards the compiled plan and the result of the last compilation.
+  void Reset();
+
+  //! Updates the compiled PVXS value from the current state of the compiled AnyValue. Only the
+  //! changed fields are marked afterwards. Returns false if the plan was not compiled.
+  bool Apply() const;
+
+private:
+  bool CompileEntries(::pvxs::Value& pvxs_value, const ::sup::dto::AnyValue& any_value);
+  struct PvxsUpdatePlanImpl;
+  std::unique_ptr<PvxsUpdatePlanImpl> p_impl;
+};
+
+}  // namespace epics
+
+}  // namespace sup
+
+#endif  // SUP_EPICS_UTILS_PVXS_UPDATE_PLAN_H_
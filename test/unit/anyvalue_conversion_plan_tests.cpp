@@ -0,0 +1,163 @@
+/******************************************************************************
+ *
+ * Project       : Supervision and automation system EPICS interface
+ *
+ * Description   : Library of SUP components for EPICS network protocol
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include <sup/dto/anyvalue.h>
+#include <sup/dto/anyvalue_helper.h>
+#include <sup/epics/utils/anyvalue_conversion_plan.h>
+#include <sup/epics/utils/dto_conversion_utils.h>
+
+#include <gtest/gtest.h>
+#include <pvxs/data.h>
+
+using namespace ::sup::epics;
+
+class AnyValueConversionPlanTests : public ::testing::Test
+{
+public:
+  AnyValueConversionPlanTests()
+  {
+    sup::dto::AnyValue array_of_scalars(2, sup::dto::SignedInteger32Type);
+    array_of_scalars[0] = 42;
+    array_of_scalars[1] = 43;
+    const sup::dto::AnyValue internal_struct = {
+        {{"name", {sup::dto::StringType, "internal"}},
+         {"weight", {sup::dto::Float64Type, 1.5}},
+         {"array", array_of_scalars}},
+        "internal_struct"};
+    m_struct_value = {{{"counter", {sup::dto::UnsignedInteger32Type, 1}},
+                       {"internal", internal_struct},
+                       {"flag", {sup::dto::BooleanType, false}}},
+                      "external_struct"};
+  }
+
+  sup::dto::AnyValue m_struct_value;
+};
+
+//! Compiling a plan for a struct with nested struct and scalar array. Applying the plan to a
+//! modified PVXS value gives the same result as a full conversion.
+TEST_F(AnyValueConversionPlanTests, ApplyNestedStruct)
+{
+  auto pvxs_value = BuildPVXSValue(m_struct_value);
+  auto any_value = BuildAnyValue(pvxs_value);
+
+  AnyValueConversionPlan plan;
+  EXPECT_FALSE(plan.IsCompiled());
+  EXPECT_TRUE(plan.Compile(pvxs_value, any_value));
+  EXPECT_TRUE(plan.IsCompiled());
+
+  auto update = pvxs_value.clone();
+  update["counter"] = 2u;
+  update["internal.name"] = std::string("changed");
+  update["internal.weight"] = 2.5;
+  update["flag"] = true;
+  EXPECT_TRUE(plan.Apply(update, false));
+  EXPECT_EQ(any_value, BuildAnyValue(update));
+  EXPECT_EQ(any_value["counter"], 2u);
+  EXPECT_EQ(any_value["internal.name"], sup::dto::AnyValue(sup::dto::StringType, "changed"));
+
+  plan.Reset();
+  EXPECT_FALSE(plan.IsCompiled());
+  EXPECT_FALSE(plan.Apply(update, false));
+}
+
+//! Applying the plan to only the marked fields of an update leaves other fields untouched.
+TEST_F(AnyValueConversionPlanTests, ApplyMarkedFields)
+{
+  auto pvxs_value = BuildPVXSValue(m_struct_value);
+  auto any_value = BuildAnyValue(pvxs_value);
+
+  AnyValueConversionPlan plan;
+  EXPECT_TRUE(plan.Compile(pvxs_value, any_value));
+
+  auto update = pvxs_value.cloneEmpty();
+  update["internal.weight"] = 3.5;
+  EXPECT_TRUE(plan.Apply(update, true));
+
+  auto expected = m_struct_value;
+  expected["internal.weight"] = 3.5;
+  EXPECT_EQ(any_value, expected);
+}
+
+//! Skipped fields do not need to exist in the AnyValue and are ignored when applying the plan.
+TEST_F(AnyValueConversionPlanTests, SkippedFields)
+{
+  auto pvxs_value = BuildPVXSValue(m_struct_value);
+  const sup::dto::AnyValue stripped_value = {
+      {{"counter", {sup::dto::UnsignedInteger32Type, 1}},
+       {"flag", {sup::dto::BooleanType, false}}},
+      "external_struct"};
+  auto any_value = stripped_value;
+
+  AnyValueConversionPlan plan;
+  EXPECT_FALSE(plan.Compile(pvxs_value, any_value));
+  EXPECT_TRUE(plan.Compile(pvxs_value, any_value, {"internal"}));
+
+  auto update = pvxs_value.clone();
+  update["counter"] = 7u;
+  update["internal.weight"] = 2.5;
+  EXPECT_TRUE(plan.Apply(update, false));
+
+  auto expected = stripped_value;
+  expected["counter"] = 7u;
+  EXPECT_EQ(any_value, expected);
+}
+
+//! Struct arrays are converted as a whole. The shape is taken from the extended conversion tests.
+TEST_F(AnyValueConversionPlanTests, ApplyStructWithArrayOfStruct)
+{
+  const std::string deliberately_empty_array_name;
+  const auto& internal_struct = m_struct_value["internal"];
+  auto external_array =
+      sup::dto::ArrayValue({internal_struct, internal_struct}, deliberately_empty_array_name);
+  const sup::dto::AnyValue outside_struct = {
+      {{"counter", {sup::dto::UnsignedInteger32Type, 1}}, {"ExternalArrayField", external_array}},
+      "outside_struct_name"};
+
+  auto pvxs_value = BuildPVXSValue(outside_struct);
+  auto any_value = BuildAnyValue(pvxs_value);
+
+  AnyValueConversionPlan plan;
+  EXPECT_TRUE(plan.Compile(pvxs_value, any_value));
+
+  auto update = pvxs_value.clone();
+  update["counter"] = 5u;
+  EXPECT_TRUE(plan.Apply(update, false));
+  EXPECT_EQ(any_value, BuildAnyValue(update));
+}
+
+//! Compiling fails for an AnyValue with another layout and applying fails for another PVXS type.
+TEST_F(AnyValueConversionPlanTests, TypeMismatch)
+{
+  auto pvxs_value = BuildPVXSValue(m_struct_value);
+  AnyValueConversionPlan plan;
+
+  sup::dto::AnyValue scalar{sup::dto::SignedInteger32Type, 42};
+  EXPECT_FALSE(plan.Compile(pvxs_value, scalar));
+  EXPECT_FALSE(plan.IsCompiled());
+
+  sup::dto::AnyValue other_struct = {{"counter", {sup::dto::StringType, "one"}}};
+  EXPECT_FALSE(plan.Compile(pvxs_value, other_struct));
+  EXPECT_FALSE(plan.IsCompiled());
+
+  auto any_value = BuildAnyValue(pvxs_value);
+  EXPECT_TRUE(plan.Compile(pvxs_value, any_value));
+  const sup::dto::AnyValue other_value = {{"counter", {sup::dto::StringType, "one"}}};
+  EXPECT_FALSE(plan.Apply(BuildPVXSValue(other_value), false));
+}
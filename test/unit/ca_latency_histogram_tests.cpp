@@ -0,0 +1,97 @@
+/******************************************************************************
+ *
+ * Project       : Supervision and automation system EPICS interface
+ *
+ * Description   : Library of SUP components for EPICS network protocol
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include <sup/epics/ca_latency_histogram.h>
+
+#include <gtest/gtest.h>
+
+using namespace ::sup::epics;
+
+class CALatencyHistogramTests : public ::testing::Test
+{
+};
+
+TEST_F(CALatencyHistogramTests, Empty)
+{
+  CALatencyHistogram histogram;
+  EXPECT_EQ(histogram.GetCount(), 0);
+  EXPECT_EQ(histogram.GetMin(), 0);
+  EXPECT_EQ(histogram.GetMax(), 0);
+  EXPECT_EQ(histogram.GetMean(), 0.0);
+  EXPECT_EQ(histogram.GetValueAtPercentile(50.0), 0);
+}
+
+TEST_F(CALatencyHistogramTests, SmallValuesAreExact)
+{
+  CALatencyHistogram histogram;
+  for (sup::dto::uint64 value = 1; value <= 10; ++value)
+  {
+    histogram.Record(value);
+  }
+  EXPECT_EQ(histogram.GetCount(), 10);
+  EXPECT_EQ(histogram.GetMin(), 1);
+  EXPECT_EQ(histogram.GetMax(), 10);
+  EXPECT_DOUBLE_EQ(histogram.GetMean(), 5.5);
+  EXPECT_EQ(histogram.GetValueAtPercentile(0.0), 1);
+  EXPECT_EQ(histogram.GetValueAtPercentile(50.0), 5);
+  EXPECT_EQ(histogram.GetValueAtPercentile(90.0), 9);
+  EXPECT_EQ(histogram.GetValueAtPercentile(100.0), 10);
+}
+
+TEST_F(CALatencyHistogramTests, BoundedRelativeError)
+{
+  CALatencyHistogram histogram;
+  for (sup::dto::uint64 idx = 1; idx <= 1000; ++idx)
+  {
+    histogram.Record(idx * 10000);  // 10us .. 10ms
+  }
+  EXPECT_EQ(histogram.GetCount(), 1000);
+  EXPECT_EQ(histogram.GetMin(), 10000);
+  EXPECT_EQ(histogram.GetMax(), 10000000);
+  auto median = histogram.GetValueAtPercentile(50.0);
+  EXPECT_GE(median, 5000000);
+  EXPECT_LE(median, 5000000 * 17 / 16);
+  auto p99 = histogram.GetValueAtPercentile(99.0);
+  EXPECT_GE(p99, 9900000);
+  EXPECT_LE(p99, 10000000);
+  EXPECT_EQ(histogram.GetValueAtPercentile(100.0), 10000000);
+}
+
+TEST_F(CALatencyHistogramTests, LargeValues)
+{
+  CALatencyHistogram histogram;
+  const sup::dto::uint64 huge = 1ull << 50;
+  histogram.Record(huge);
+  EXPECT_EQ(histogram.GetMax(), huge);
+  EXPECT_EQ(histogram.GetValueAtPercentile(50.0), huge);
+}
+
+TEST_F(CALatencyHistogramTests, Reset)
+{
+  CALatencyHistogram histogram;
+  histogram.Record(1000);
+  histogram.Record(2000);
+  CALatencyHistogram copy{histogram};
+  histogram.Reset();
+  EXPECT_EQ(histogram.GetCount(), 0);
+  EXPECT_EQ(histogram.GetMax(), 0);
+  EXPECT_EQ(copy.GetCount(), 2);
+  EXPECT_EQ(copy.GetMin(), 1000);
+}
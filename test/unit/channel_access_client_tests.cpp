@@ -171,6 +171,16 @@ TEST_F(ChannelAccessClientTest, SingleClient)
   EXPECT_TRUE(now_timestamp > static_cast<long>(timestamp));
   EXPECT_NE(timestamp, 0);
 
+  // metrics
+  auto bool_metrics = client.GetMetrics(BOOL_CHANNEL);
+  EXPECT_EQ(bool_metrics.connections, 1);
+  EXPECT_GE(bool_metrics.monitors_received, 1);
+  EXPECT_GE(bool_metrics.puts, 1);
+  auto unknown_metrics = client.GetMetrics(UNKNOWN_CHANNEL);
+  EXPECT_EQ(unknown_metrics.monitors_received, 0);
+  auto context_metrics = client.GetContextMetrics();
+  EXPECT_GT(context_metrics.tasks_handled, 0);
+
   // remove variable
   EXPECT_TRUE(client.RemoveVariable(CHARRAY_CHANNEL));
   EXPECT_FALSE(client.RemoveVariable(UNKNOWN_CHANNEL));
@@ -25,6 +25,8 @@
 #include <sup/dto/anyvalue.h>
 #include <sup/epics/channel_access_pv.h>
 
+#include <cadef.h>
+
 #include <thread>
 
 #include <sup/epics-test/softioc_runner.h>
@@ -638,6 +640,36 @@ TEST_F(ChannelAccessPVTest, CharWaveform)
   }
 }
 
+TEST_F(ChannelAccessPVTest, LongStringWaveform)
+{
+  using namespace sup::epics;
+
+  const auto long_string_t = LongStringType(1024);
+  EXPECT_TRUE(IsLongStringType(long_string_t));
+  EXPECT_FALSE(IsLongStringType(sup::dto::AnyType(1024, sup::dto::Character8Type, "char8[]")));
+  EXPECT_FALSE(IsLongStringType(sup::dto::StringType));
+
+  ChannelAccessPV ca_longstring_var("CA-TESTS:CHARRAY", long_string_t);
+  EXPECT_TRUE(ca_longstring_var.WaitForConnected(5.0));
+
+  // write and read back a string longer than an EPICS string
+  const std::string long_string =
+    "Some very long string which is longer than the maximum length of EPICSv3 string and "
+    "should be serialised on a waveform record";
+  EXPECT_TRUE(ca_longstring_var.SetValue(long_string));
+  EXPECT_TRUE(WaitForValue(ca_longstring_var, long_string, 5.0));
+  EXPECT_EQ(ca_longstring_var.GetValue().GetType(), sup::dto::StringType);
+
+  // shorter string does not keep the tail of the previous one
+  const std::string short_string = "short";
+  EXPECT_TRUE(ca_longstring_var.SetValue(short_string));
+  EXPECT_TRUE(WaitForValue(ca_longstring_var, short_string, 5.0));
+
+  // strings that do not fit, including the terminating null character, are rejected
+  EXPECT_FALSE(ca_longstring_var.SetValue(std::string(1024, 'a')));
+  EXPECT_FALSE(ca_longstring_var.SetValue(sup::dto::AnyValue{sup::dto::Float64Type}));
+}
+
 TEST_F(ChannelAccessPVTest, UInt64Waveform)
 {
   using namespace sup::epics;
@@ -725,6 +757,93 @@ TEST_F(ChannelAccessPVTest, ShortenedWaveform)
   EXPECT_TRUE(WaitForValue(ca_floatarray_var, float_array_v, 5.0));
 }
 
+TEST_F(ChannelAccessPVTest, QoSClasses)
+{
+  using namespace sup::epics;
+
+  EXPECT_EQ(ParseCAQoSClass(kCAQoSBulk), std::make_pair(true, CAQoSClass::kBulk));
+  EXPECT_EQ(ParseCAQoSClass(kCAQoSDefault), std::make_pair(true, CAQoSClass::kDefault));
+  EXPECT_EQ(ParseCAQoSClass(kCAQoSCritical), std::make_pair(true, CAQoSClass::kCritical));
+  EXPECT_FALSE(ParseCAQoSClass("urgent").first);
+  EXPECT_LT(CAPriority(CAQoSClass::kBulk), CAPriority(CAQoSClass::kDefault));
+  EXPECT_LT(CAPriority(CAQoSClass::kDefault), CAPriority(CAQoSClass::kCritical));
+  EXPECT_LE(CAPriority(CAQoSClass::kCritical), CA_PRIORITY_MAX);
+
+  // channels with different priorities use different circuits but see the same values
+  ChannelAccessPV critical_var("CA-TESTS:FLOAT", sup::dto::Float32Type, {},
+                               CAQoSClass::kCritical);
+  ChannelAccessPV bulk_var("CA-TESTS:FLOAT", sup::dto::Float32Type, {}, CAQoSClass::kBulk);
+  EXPECT_EQ(critical_var.GetQoSClass(), CAQoSClass::kCritical);
+  EXPECT_EQ(bulk_var.GetQoSClass(), CAQoSClass::kBulk);
+  EXPECT_TRUE(critical_var.WaitForConnected(5.0));
+  EXPECT_TRUE(bulk_var.WaitForConnected(5.0));
+
+  const sup::dto::float32 float_val = 4.25F;
+  EXPECT_TRUE(critical_var.SetValue(float_val));
+  EXPECT_TRUE(WaitForValue(critical_var, float_val, 5.0));
+  EXPECT_TRUE(WaitForValue(bulk_var, float_val, 5.0));
+}
+
+TEST_F(ChannelAccessPVTest, Metrics)
+{
+  using namespace sup::epics;
+
+  ChannelAccessPV ca_float_var("CA-TESTS:FLOAT", sup::dto::Float32Type);
+  EXPECT_TRUE(ca_float_var.WaitForValidValue(5.0));
+
+  auto metrics = ca_float_var.GetMetrics();
+  EXPECT_EQ(metrics.connections, 1);
+  EXPECT_EQ(metrics.disconnections, 0);
+  EXPECT_GE(metrics.monitors_received, 1);
+  EXPECT_GE(metrics.bytes_decoded, sizeof(sup::dto::float32));
+  EXPECT_EQ(metrics.decode_failures, 0);
+  EXPECT_EQ(metrics.puts, 0);
+  sup::dto::uint64 histogram_total = 0;
+  for (auto count : metrics.decode_time_histogram)
+  {
+    histogram_total += count;
+  }
+  EXPECT_EQ(histogram_total, metrics.monitors_received);
+
+  // put updates the put counters
+  const sup::dto::float32 float_val = 1.5F;
+  EXPECT_TRUE(ca_float_var.SetValue(float_val));
+  EXPECT_TRUE(WaitForValue(ca_float_var, float_val, 5.0));
+  metrics = ca_float_var.GetMetrics();
+  EXPECT_EQ(metrics.puts, 1);
+  EXPECT_GE(metrics.put_latency_total_ns, metrics.put_latency_max_ns);
+  EXPECT_GT(metrics.put_latency_max_ns, 0);
+}
+
+TEST_F(ChannelAccessPVTest, LatencyTracing)
+{
+  using namespace sup::epics;
+
+  ChannelAccessPV ca_float_var("CA-TESTS:FLOAT", sup::dto::Float32Type);
+  EXPECT_TRUE(ca_float_var.WaitForValidValue(5.0));
+
+  // tracing is disabled by default
+  auto latencies = ca_float_var.GetLatencyMetrics();
+  EXPECT_EQ(latencies.receive_to_delivery.GetCount(), 0);
+
+  ca_float_var.EnableLatencyTracing(true);
+  const sup::dto::float32 float_val = 2.5F;
+  EXPECT_TRUE(ca_float_var.SetValue(float_val));
+  EXPECT_TRUE(WaitForValue(ca_float_var, float_val, 5.0));
+  latencies = ca_float_var.GetLatencyMetrics();
+  EXPECT_GE(latencies.receive_to_decode.GetCount(), 1);
+  EXPECT_EQ(latencies.decode_to_delivery.GetCount(), latencies.receive_to_decode.GetCount());
+  EXPECT_EQ(latencies.receive_to_delivery.GetCount(), latencies.receive_to_decode.GetCount());
+  EXPECT_EQ(latencies.ioc_to_receive.GetCount() + latencies.negative_skew_count,
+            latencies.receive_to_decode.GetCount());
+  EXPECT_GE(latencies.receive_to_delivery.GetMax(), latencies.receive_to_decode.GetMin());
+
+  // disabling clears the histograms
+  ca_float_var.EnableLatencyTracing(false);
+  latencies = ca_float_var.GetLatencyMetrics();
+  EXPECT_EQ(latencies.receive_to_delivery.GetCount(), 0);
+}
+
 TEST_F(ChannelAccessPVTest, DISABLED_ShortLivedPV)
 {
   using namespace sup::epics;
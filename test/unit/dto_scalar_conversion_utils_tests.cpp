@@ -658,3 +658,39 @@ TEST_F(AnyValueScalarConversionUtilsTests, GetAnyValueFromScalarArray)
     EXPECT_THROW(GetAnyValueFromScalarArray(pvxs_value), std::runtime_error);
   }
 }
+
+//! Comparing PVXS scalars and scalar arrays with AnyValues in place.
+
+TEST_F(AnyValueScalarConversionUtilsTests, IsEqualScalarAndScalarArray)
+{
+  {  // Int32
+    auto pvxs_value = pvxs::TypeDef(pvxs::TypeCode::Int32).create();
+    pvxs_value = 42;
+    EXPECT_TRUE(IsEqualScalar(pvxs_value, sup::dto::AnyValue{sup::dto::SignedInteger32Type, 42}));
+    EXPECT_FALSE(IsEqualScalar(pvxs_value, sup::dto::AnyValue{sup::dto::SignedInteger32Type, 43}));
+  }
+
+  {  // String
+    auto pvxs_value = pvxs::TypeDef(pvxs::TypeCode::String).create();
+    pvxs_value = std::string("abc");
+    EXPECT_TRUE(IsEqualScalar(pvxs_value, sup::dto::AnyValue{sup::dto::StringType, "abc"}));
+    EXPECT_FALSE(IsEqualScalar(pvxs_value, sup::dto::AnyValue{sup::dto::StringType, "abd"}));
+  }
+
+  {  // Float64A
+    auto pvxs_value = pvxs::TypeDef(pvxs::TypeCode::Float64A).create();
+    ::pvxs::shared_array<double> array({1.0, 2.0, 3.0});
+    pvxs_value = array.freeze();
+
+    sup::dto::AnyValue any_value(3, sup::dto::Float64Type);
+    any_value[0] = 1.0;
+    any_value[1] = 2.0;
+    any_value[2] = 3.0;
+    EXPECT_TRUE(IsEqualScalarArray(pvxs_value, any_value));
+    any_value[2] = 4.0;
+    EXPECT_FALSE(IsEqualScalarArray(pvxs_value, any_value));
+    const sup::dto::AnyValue shorter(2, sup::dto::Float64Type);
+    EXPECT_FALSE(IsEqualScalarArray(pvxs_value, shorter));
+    EXPECT_THROW(IsEqualScalarArray(pvxs_value, sup::dto::AnyValue{1.0}), std::runtime_error);
+  }
+}
@@ -25,6 +25,8 @@
 #include <sup/dto/anyvalue.h>
 #include <sup/protocol/protocol_factory_utils.h>
 
+#include <sup/epics-test/unit_test_helper.h>
+
 #include <gtest/gtest.h>
 
 #include <future>
@@ -180,6 +182,52 @@ TEST_F(EPICSProtocolFactoryTest, PvAccessPVWrappers)
   EXPECT_TRUE(WaitForVariableValue(*client_var_2, val_init, 2.0));
 }
 
+//! Server variables of the same group share a single server. Destroying one of them removes only
+//! its channel from the server.
+TEST_F(EPICSProtocolFactoryTest, PvAccessServerPVWrappersInGroup)
+{
+  const std::string channel_name_1 = "PVWrapperTest::GroupVariable1";
+  const std::string channel_name_2 = "PVWrapperTest::GroupVariable2";
+  const sup::dto::AnyValue val_1 = {{
+    { "setpoint", { sup::dto::Float64Type, 1.0 }}
+  }};
+  const sup::dto::AnyValue val_2 = {{
+    { "setpoint", { sup::dto::Float64Type, 2.0 }}
+  }};
+  auto server_var_1 = m_factory.CreateProcessVariable({{
+    { kProcessVariableClass, kPvAccessServerClass },
+    { kChannelName, channel_name_1 },
+    { kVariableValue, val_1 },
+    { kServerGroup, "PVWrapperTestGroup" }
+  }});
+  auto server_var_2 = m_factory.CreateProcessVariable({{
+    { kProcessVariableClass, kPvAccessServerClass },
+    { kChannelName, channel_name_2 },
+    { kVariableValue, val_2 },
+    { kServerGroup, "PVWrapperTestGroup" }
+  }});
+
+  auto client_var_1 = m_factory.CreateProcessVariable({{
+    { kProcessVariableClass, kPvAccessClientClass },
+    { kChannelName, channel_name_1 }
+  }});
+  auto client_var_2 = m_factory.CreateProcessVariable({{
+    { kProcessVariableClass, kPvAccessClientClass },
+    { kChannelName, channel_name_2 }
+  }});
+  EXPECT_TRUE(WaitForVariableValue(*client_var_1, val_1, 2.0));
+  EXPECT_TRUE(WaitForVariableValue(*client_var_2, val_2, 2.0));
+
+  // Removing the first server variable disconnects its client only
+  server_var_1.reset();
+  EXPECT_TRUE(WaitForVariableValue(*client_var_2, val_2, 1.0));
+  auto updated_val = val_2;
+  updated_val["setpoint"] = 3.0;
+  EXPECT_TRUE(SetVariableValue(*server_var_2, updated_val));
+  EXPECT_TRUE(WaitForVariableValue(*client_var_2, updated_val, 2.0));
+  EXPECT_TRUE(test::BusyWaitFor(2.0, [&]() { return !client_var_1->IsAvailable(); }));
+}
+
 TEST_F(EPICSProtocolFactoryTest, TwoChannelAccessPVWrapperServerCallback)
 {
   std::string channel_name = "PVWrapperTest::ServerCallback";
@@ -19,6 +19,7 @@
  *****************************************************************************/
 
 #include <sup/epics/epics_protocol_factory.h>
+#include <sup/epics/pv_access_client_context.h>
 #include <sup/epics/factory/epics_protocol_factory_utils.h>
 
 #include <sup/dto/anyvalue.h>
@@ -35,6 +36,76 @@ protected:
   ~EPICSProtocolFactoryUtilsTest() override = default;
 };
 
+TEST_F(EPICSProtocolFactoryUtilsTest, ParsePvAccessRPCServerConfig)
+{
+  {
+    // No service field throws
+    const sup::dto::AnyValue config = {{
+      { kHandlerThreads, { sup::dto::UnsignedInteger32Type, 4 } }
+    }};
+    EXPECT_THROW(utils::ParsePvAccessRPCServerConfig(config),
+                 sup::protocol::InvalidOperationException);
+  }
+  {
+    // Only service field
+    const sup::dto::AnyValue config = {{
+      { kServiceName, { sup::dto::StringType, "MyServiceName"} }
+    }};
+    auto server_config = utils::ParsePvAccessRPCServerConfig(config);
+    EXPECT_EQ(server_config.service_name, "MyServiceName");
+    EXPECT_EQ(server_config.handler_threads, 0u);
+  }
+  {
+    // Wrong type of handler threads field throws
+    const sup::dto::AnyValue config = {{
+      { kServiceName, { sup::dto::StringType, "MyServiceName"} },
+      { kHandlerThreads, -4 }
+    }};
+    EXPECT_THROW(utils::ParsePvAccessRPCServerConfig(config),
+                 sup::protocol::InvalidOperationException);
+  }
+  {
+    // Correct handler threads field is taken into account
+    const sup::dto::AnyValue config = {{
+      { kServiceName, { sup::dto::StringType, "MyServiceName"} },
+      { kHandlerThreads, { sup::dto::UnsignedInteger32Type, 4 } }
+    }};
+    auto server_config = utils::ParsePvAccessRPCServerConfig(config);
+    EXPECT_EQ(server_config.service_name, "MyServiceName");
+    EXPECT_EQ(server_config.handler_threads, 4u);
+    EXPECT_EQ(server_config.max_pending_requests, 0u);
+    EXPECT_EQ(server_config.max_in_flight_requests, 0u);
+  }
+  {
+    // Wrong type of admission control fields throws
+    const sup::dto::AnyValue config = {{
+      { kServiceName, { sup::dto::StringType, "MyServiceName"} },
+      { kMaxPendingRequests, 2.0 }
+    }};
+    EXPECT_THROW(utils::ParsePvAccessRPCServerConfig(config),
+                 sup::protocol::InvalidOperationException);
+    const sup::dto::AnyValue config2 = {{
+      { kServiceName, { sup::dto::StringType, "MyServiceName"} },
+      { kMaxInFlightRequests, "many" }
+    }};
+    EXPECT_THROW(utils::ParsePvAccessRPCServerConfig(config2),
+                 sup::protocol::InvalidOperationException);
+  }
+  {
+    // Correct admission control fields are taken into account
+    const sup::dto::AnyValue config = {{
+      { kServiceName, { sup::dto::StringType, "MyServiceName"} },
+      { kHandlerThreads, { sup::dto::UnsignedInteger32Type, 2 } },
+      { kMaxPendingRequests, { sup::dto::UnsignedInteger32Type, 8 } },
+      { kMaxInFlightRequests, { sup::dto::UnsignedInteger32Type, 10 } }
+    }};
+    auto server_config = utils::ParsePvAccessRPCServerConfig(config);
+    EXPECT_EQ(server_config.handler_threads, 2u);
+    EXPECT_EQ(server_config.max_pending_requests, 8u);
+    EXPECT_EQ(server_config.max_in_flight_requests, 10u);
+  }
+}
+
 TEST_F(EPICSProtocolFactoryUtilsTest, ParsePvAccessRPCClientConfig)
 {
   {
@@ -90,6 +161,28 @@ TEST_F(EPICSProtocolFactoryUtilsTest, ParsePvAccessRPCClientConfig)
     auto client_config = utils::ParsePvAccessRPCClientConfig(config);
     EXPECT_EQ(client_config.service_name, "MyServiceName");
     EXPECT_EQ(client_config.timeout, 2.0);
+    EXPECT_TRUE(client_config.context_name.empty());
+  }
+  {
+    // Unknown client context throws
+    const sup::dto::AnyValue config = {{
+      { kServiceName, { sup::dto::StringType, "MyServiceName"} },
+      { kContextName, "UnknownContext" }
+    }};
+    EXPECT_THROW(utils::ParsePvAccessRPCClientConfig(config),
+                 sup::protocol::InvalidOperationException);
+  }
+  {
+    // Existing client context is taken into account
+    const std::string context_name = "ParseRPCClientConfigContext";
+    CreatePvAccessClientContext(context_name, GetDefaultClientContextConfig());
+    const sup::dto::AnyValue config = {{
+      { kServiceName, { sup::dto::StringType, "MyServiceName"} },
+      { kContextName, context_name }
+    }};
+    auto client_config = utils::ParsePvAccessRPCClientConfig(config);
+    EXPECT_EQ(client_config.context_name, context_name);
+    EXPECT_EQ(client_config.timeout, 5.0); // default timeout
   }
 }
 
@@ -138,6 +231,26 @@ TEST_F(EPICSProtocolFactoryUtilsTest, CreateChannelAccessClientVar)
     EXPECT_THROW(utils::CreateChannelAccessClientVar(config),
                  sup::protocol::InvalidOperationException);
   }
+  {
+    // Wrong quality of service field throws
+    const sup::dto::AnyValue config = {{
+      { kChannelName, "MyChannel" },
+      { kVariableType, R"RAW({"type":"float64"})RAW" },
+      { kQoSClass, 42 }
+    }};
+    EXPECT_THROW(utils::CreateChannelAccessClientVar(config),
+                 sup::protocol::InvalidOperationException);
+  }
+  {
+    // Unknown quality of service class throws
+    const sup::dto::AnyValue config = {{
+      { kChannelName, "MyChannel" },
+      { kVariableType, R"RAW({"type":"float64"})RAW" },
+      { kQoSClass, "urgent" }
+    }};
+    EXPECT_THROW(utils::CreateChannelAccessClientVar(config),
+                 sup::protocol::InvalidOperationException);
+  }
   {
     // Correct configuration
     const sup::dto::AnyValue config = {{
@@ -146,6 +259,15 @@ TEST_F(EPICSProtocolFactoryUtilsTest, CreateChannelAccessClientVar)
     }};
     EXPECT_NO_THROW(utils::CreateChannelAccessClientVar(config));
   }
+  {
+    // Correct configuration with quality of service class
+    const sup::dto::AnyValue config = {{
+      { kChannelName, "MyChannel" },
+      { kVariableType, R"RAW({"type":"float64"})RAW" },
+      { kQoSClass, kCAQoSCritical }
+    }};
+    EXPECT_NO_THROW(utils::CreateChannelAccessClientVar(config));
+  }
 }
 
 TEST_F(EPICSProtocolFactoryUtilsTest, CreatePvAccessClientVar)
@@ -171,6 +293,52 @@ TEST_F(EPICSProtocolFactoryUtilsTest, CreatePvAccessClientVar)
     }};
     EXPECT_NO_THROW(utils::CreatePvAccessClientVar(config));
   }
+  {
+    // Wrong field selection throws
+    const sup::dto::AnyValue config = {{
+      { kChannelName, "MyChannel" },
+      { kFieldSelection, 42 }
+    }};
+    EXPECT_THROW(utils::CreatePvAccessClientVar(config),
+                 sup::protocol::InvalidOperationException);
+  }
+  {
+    // Wrong queue size throws
+    const sup::dto::AnyValue config = {{
+      { kChannelName, "MyChannel" },
+      { kQueueSize, -1 }
+    }};
+    EXPECT_THROW(utils::CreatePvAccessClientVar(config),
+                 sup::protocol::InvalidOperationException);
+  }
+  {
+    // Wrong pipeline field throws
+    const sup::dto::AnyValue config = {{
+      { kChannelName, "MyChannel" },
+      { kPipeline, "yes" }
+    }};
+    EXPECT_THROW(utils::CreatePvAccessClientVar(config),
+                 sup::protocol::InvalidOperationException);
+  }
+  {
+    // Correct configuration with monitor options
+    const sup::dto::AnyValue config = {{
+      { kChannelName, "MyChannel" },
+      { kFieldSelection, "value,timeStamp" },
+      { kQueueSize, { sup::dto::UnsignedInteger32Type, 8 } },
+      { kPipeline, true }
+    }};
+    EXPECT_NO_THROW(utils::CreatePvAccessClientVar(config));
+  }
+  {
+    // Unknown client context throws
+    const sup::dto::AnyValue config = {{
+      { kChannelName, "MyChannel" },
+      { kContextName, "UnknownContext" }
+    }};
+    EXPECT_THROW(utils::CreatePvAccessClientVar(config),
+                 sup::protocol::InvalidOperationException);
+  }
 }
 
 TEST_F(EPICSProtocolFactoryUtilsTest, CreatePvAccessServerVar)
@@ -214,4 +382,62 @@ TEST_F(EPICSProtocolFactoryUtilsTest, CreatePvAccessServerVar)
     }};
     EXPECT_NO_THROW(utils::CreatePvAccessServerVar(config));
   }
+  {
+    // Wrong server group field throws
+    const sup::dto::AnyValue config = {{
+      { kChannelName, "MyChannel" },
+      { kVariableValue, {{
+        { "ID", 42 }
+      }}},
+      { kServerGroup, 42 }
+    }};
+    EXPECT_THROW(utils::CreatePvAccessServerVar(config),
+                 sup::protocol::InvalidOperationException);
+  }
+  {
+    // Correct configuration with server group
+    const sup::dto::AnyValue config = {{
+      { kChannelName, "MyChannel" },
+      { kVariableValue, {{
+        { "ID", 42 }
+      }}},
+      { kServerGroup, "MyGroup" }
+    }};
+    EXPECT_NO_THROW(utils::CreatePvAccessServerVar(config));
+  }
+  {
+    // Wrong maximum post rate field type throws
+    const sup::dto::AnyValue config = {{
+      { kChannelName, "MyChannel" },
+      { kVariableValue, {{
+        { "ID", 42 }
+      }}},
+      { kMaxPostRate, "fast" }
+    }};
+    EXPECT_THROW(utils::CreatePvAccessServerVar(config),
+                 sup::protocol::InvalidOperationException);
+  }
+  {
+    // Negative maximum post rate throws
+    const sup::dto::AnyValue config = {{
+      { kChannelName, "MyChannel" },
+      { kVariableValue, {{
+        { "ID", 42 }
+      }}},
+      { kMaxPostRate, -1.0 }
+    }};
+    EXPECT_THROW(utils::CreatePvAccessServerVar(config),
+                 sup::protocol::InvalidOperationException);
+  }
+  {
+    // Correct configuration with maximum post rate
+    const sup::dto::AnyValue config = {{
+      { kChannelName, "MyChannel" },
+      { kVariableValue, {{
+        { "ID", 42 }
+      }}},
+      { kMaxPostRate, 10.0 }
+    }};
+    EXPECT_NO_THROW(utils::CreatePvAccessServerVar(config));
+  }
 }
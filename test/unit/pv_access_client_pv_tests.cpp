@@ -34,6 +34,14 @@
 
 #include <sup/epics-test/unit_test_helper.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 using namespace sup::epics;
 using test::BusyWaitFor;
 using ::testing::_;
@@ -98,6 +106,14 @@ TEST_F(PvAccessClientPVTests, ExtendedValues)
     ext_2.value = val2;
     EXPECT_NE(ext_1, ext_2);
   }
+  {
+    // If alarm severities are different, extended values are different
+    PvAccessClientPV::ExtendedValue ext_1{};
+    ext_1.severity = 1;
+    PvAccessClientPV::ExtendedValue ext_2{};
+    ext_2.severity = 2;
+    EXPECT_NE(ext_1, ext_2);
+  }
   {
     // If values and connected are the same, extended values are equal
     PvAccessClientPV::ExtendedValue ext_1{};
@@ -251,6 +267,341 @@ TEST_F(PvAccessClientPVTests, CallbackAfterConnection)
   EXPECT_EQ(result, BuildAnyValue(m_pvxs_value));
 }
 
+//! A server with a single variable is created and started before the client.
+//! The client is constructed in every update mode and the server posts a sequence of values.
+//! Check that every posted value was reported through the callback.
+
+TEST_F(PvAccessClientPVTests, CallbackForEveryUpdate)
+{
+  m_server.start();
+  m_shared_pv.open(m_pvxs_value);
+
+  std::mutex mtx;
+  std::vector<int> reported_values;
+  auto callback = [&mtx, &reported_values](const PvAccessClientPV::ExtendedValue& value)
+  {
+    if (value.connected && value.value.HasField("value"))
+    {
+      std::lock_guard<std::mutex> lk(mtx);
+      reported_values.push_back(value.value["value"].As<int>());
+    }
+  };
+  auto context = std::make_shared<pvxs::client::Context>(m_server.clientConfig().build());
+  auto config = GetDefaultClientPVConfig();
+  config.update_mode = PvAccessUpdateMode::kEveryUpdate;
+  const PvAccessClientPV variable(
+      std::make_unique<PvAccessClientPVImpl>(kChannelName, context, callback, config));
+
+  EXPECT_TRUE(variable.WaitForValidValue(1.0));
+
+  const int n_updates = 5;
+  for (int i = 1; i <= n_updates; ++i)
+  {
+    auto update = m_pvxs_value.cloneEmpty();
+    update["value"] = kInitialValue + i;
+    m_shared_pv.post(update);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  }
+  EXPECT_TRUE(BusyWaitFor(1.0,
+                          [&mtx, &reported_values]()
+                          {
+                            std::lock_guard<std::mutex> lk(mtx);
+                            return !reported_values.empty()
+                                   && reported_values.back() == kInitialValue + n_updates;
+                          }));
+  std::lock_guard<std::mutex> lk(mtx);
+  for (int i = 1; i <= n_updates; ++i)
+  {
+    EXPECT_NE(std::find(reported_values.begin(), reported_values.end(), kInitialValue + i),
+              reported_values.end());
+  }
+  EXPECT_EQ(variable.GetValue()["value"], kInitialValue + n_updates);
+}
+
+//! A server with a single variable is created and started before the client.
+//! The client, in the default conflating mode, is blocked in its callback while the server posts a
+//! burst of values. Check that the queued values are merged into a single update with the latest
+//! value, so none of the intermediate values is reported.
+
+TEST_F(PvAccessClientPVTests, ConflateQueuedUpdates)
+{
+  m_server.start();
+  m_shared_pv.open(m_pvxs_value);
+
+  std::mutex mtx;
+  std::vector<int> reported_values;
+  std::atomic<bool> was_blocked{false};
+  std::promise<void> blocked;
+  std::promise<void> release;
+  auto release_future = release.get_future();
+  auto callback = [&](const PvAccessClientPV::ExtendedValue& value)
+  {
+    if (!value.connected || !value.value.HasField("value"))
+    {
+      return;
+    }
+    auto reported = value.value["value"].As<int>();
+    {
+      std::lock_guard<std::mutex> lk(mtx);
+      reported_values.push_back(reported);
+    }
+    if (reported == kInitialValue + 1 && !was_blocked.exchange(true))
+    {
+      blocked.set_value();
+      release_future.wait();
+    }
+  };
+  auto context = std::make_shared<pvxs::client::Context>(m_server.clientConfig().build());
+  auto config = GetDefaultClientPVConfig();
+  // The monitor queue holds the complete burst, so it is not squashed by the server.
+  config.queue_size = 16;
+  const PvAccessClientPV variable(
+      std::make_unique<PvAccessClientPVImpl>(kChannelName, context, callback, config));
+  EXPECT_TRUE(variable.WaitForValidValue(1.0));
+
+  auto update = m_pvxs_value.cloneEmpty();
+  update["value"] = kInitialValue + 1;
+  m_shared_pv.post(update);
+  ASSERT_EQ(blocked.get_future().wait_for(std::chrono::seconds(1)), std::future_status::ready);
+
+  const int n_updates = 5;
+  for (int i = 2; i <= n_updates; ++i)
+  {
+    update = m_pvxs_value.cloneEmpty();
+    update["value"] = kInitialValue + i;
+    m_shared_pv.post(update);
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  release.set_value();
+
+  EXPECT_TRUE(BusyWaitFor(1.0,
+                          [&mtx, &reported_values]()
+                          {
+                            std::lock_guard<std::mutex> lk(mtx);
+                            return reported_values.back() == kInitialValue + n_updates;
+                          }));
+  std::lock_guard<std::mutex> lk(mtx);
+  for (int i = 2; i < n_updates; ++i)
+  {
+    EXPECT_EQ(std::find(reported_values.begin(), reported_values.end(), kInitialValue + i),
+              reported_values.end());
+  }
+  EXPECT_EQ(variable.GetValue()["value"], kInitialValue + n_updates);
+}
+
+//! A server with a single variable is created and started before the client.
+//! The client only subscribes to the value field, with a pipelined monitor queue.
+
+TEST_F(PvAccessClientPVTests, FieldSelection)
+{
+  m_server.start();
+  m_shared_pv.open(m_pvxs_value);
+
+  auto context = std::make_shared<pvxs::client::Context>(m_server.clientConfig().build());
+  auto config = GetDefaultClientPVConfig();
+  config.fields = "value";
+  config.queue_size = 4;
+  config.pipeline = true;
+  const PvAccessClientPV variable(
+      std::make_unique<PvAccessClientPVImpl>(kChannelName, context, nullptr, config));
+
+  EXPECT_TRUE(variable.WaitForValidValue(1.0));
+
+  auto result = variable.GetValue();
+  ASSERT_TRUE(result.HasField("value"));
+  EXPECT_EQ(result["value"], kInitialValue);
+  EXPECT_FALSE(result.HasField("alarm"));
+  EXPECT_FALSE(result.HasField("timeStamp"));
+
+  auto update = m_pvxs_value.cloneEmpty();
+  update["value"] = kInitialValue + 1;
+  m_shared_pv.post(update);
+  EXPECT_TRUE(BusyWaitFor(1.0,
+                          [&variable]()
+                          { return variable.GetValue()["value"] == kInitialValue + 1; }));
+}
+
+//! A server with a single variable is created and started before the client.
+//! The client only subscribes to the value field and writes it back. Check that the put is applied
+//! onto the channel's full type and leaves the other fields unchanged.
+
+TEST_F(PvAccessClientPVTests, SetWithFieldSelection)
+{
+  m_server.start();
+  m_shared_pv.open(m_pvxs_value);
+
+  auto context = std::make_shared<pvxs::client::Context>(m_server.clientConfig().build());
+  auto config = GetDefaultClientPVConfig();
+  config.fields = "value";
+  PvAccessClientPV variable(
+      std::make_unique<PvAccessClientPVImpl>(kChannelName, context, nullptr, config));
+
+  EXPECT_TRUE(variable.WaitForValidValue(1.0));
+
+  auto any_value = variable.GetValue();
+  any_value["value"] = kInitialValue + 1;
+  EXPECT_TRUE(variable.SetValue(any_value));
+  auto shared_value = m_shared_pv.fetch();
+  EXPECT_EQ(shared_value["value"].as<int>(), kInitialValue + 1);
+  EXPECT_EQ(shared_value["alarm.status"].as<int>(), kInitialStatus);
+
+  EXPECT_TRUE(variable.SetField("value", sup::dto::AnyValue{sup::dto::SignedInteger32Type,
+                                                            kInitialValue + 2}));
+  shared_value = m_shared_pv.fetch();
+  EXPECT_EQ(shared_value["value"].as<int>(), kInitialValue + 2);
+  EXPECT_EQ(shared_value["alarm.status"].as<int>(), kInitialStatus);
+}
+
+//! A server with a single variable is created and started before the client.
+//! The extended value contains the decoded timestamp and alarm fields, which can be stripped from
+//! the value.
+
+TEST_F(PvAccessClientPVTests, TimestampAndAlarm)
+{
+  m_pvxs_value["timeStamp.secondsPastEpoch"] = 1700000000;
+  m_pvxs_value["timeStamp.nanoseconds"] = 123;
+  m_pvxs_value["alarm.severity"] = 2;
+  m_server.start();
+  m_shared_pv.open(m_pvxs_value);
+
+  const PvAccessClientPV variable(CreateClientPVImpl(kChannelName));
+  EXPECT_TRUE(variable.WaitForValidValue(1.0));
+
+  auto ext_value = variable.GetExtendedValue();
+  EXPECT_EQ(ext_value.timestamp, 1700000000000000123u);
+  EXPECT_EQ(ext_value.status, kInitialStatus);
+  EXPECT_EQ(ext_value.severity, 2);
+  EXPECT_TRUE(ext_value.value.HasField("alarm"));
+  EXPECT_TRUE(ext_value.value.HasField("timeStamp"));
+
+  auto context = std::make_shared<pvxs::client::Context>(m_server.clientConfig().build());
+  auto config = GetDefaultClientPVConfig();
+  config.strip_metadata = true;
+  const PvAccessClientPV stripped_variable(
+      std::make_unique<PvAccessClientPVImpl>(kChannelName, context, nullptr, config));
+  EXPECT_TRUE(stripped_variable.WaitForValidValue(1.0));
+
+  auto stripped_value = stripped_variable.GetExtendedValue();
+  EXPECT_EQ(stripped_value.timestamp, 1700000000000000123u);
+  EXPECT_EQ(stripped_value.severity, 2);
+  EXPECT_EQ(stripped_value.value["value"], kInitialValue);
+  EXPECT_FALSE(stripped_value.value.HasField("alarm"));
+  EXPECT_FALSE(stripped_value.value.HasField("timeStamp"));
+
+  // an update of the metadata only is decoded by both variables
+  auto update = m_pvxs_value.cloneEmpty();
+  update["alarm.severity"] = 1;
+  m_shared_pv.post(update);
+  EXPECT_TRUE(BusyWaitFor(1.0,
+                          [&variable, &stripped_variable]()
+                          {
+                            return variable.GetExtendedValue().severity == 1
+                                   && stripped_variable.GetExtendedValue().severity == 1;
+                          }));
+  EXPECT_EQ(stripped_variable.GetValue()["value"], kInitialValue);
+}
+
+//! A server with a single variable is created and started before the client.
+//! The client strips the metadata from its value and writes it back. Check that the put is
+//! applied onto the channel's full type and leaves the alarm and timestamp unchanged.
+
+TEST_F(PvAccessClientPVTests, SetWithStrippedMetadata)
+{
+  m_pvxs_value["timeStamp.secondsPastEpoch"] = 1700000000;
+  m_server.start();
+  m_shared_pv.open(m_pvxs_value);
+
+  auto context = std::make_shared<pvxs::client::Context>(m_server.clientConfig().build());
+  auto config = GetDefaultClientPVConfig();
+  config.strip_metadata = true;
+  PvAccessClientPV variable(
+      std::make_unique<PvAccessClientPVImpl>(kChannelName, context, nullptr, config));
+  EXPECT_TRUE(variable.WaitForValidValue(1.0));
+
+  auto any_value = variable.GetValue();
+  ASSERT_FALSE(any_value.HasField("alarm"));
+  any_value["value"] = kInitialValue + 1;
+  EXPECT_TRUE(variable.SetValue(any_value));
+  auto shared_value = m_shared_pv.fetch();
+  EXPECT_EQ(shared_value["value"].as<int>(), kInitialValue + 1);
+  EXPECT_EQ(shared_value["alarm.status"].as<int>(), kInitialStatus);
+  EXPECT_EQ(shared_value["timeStamp.secondsPastEpoch"].as<int>(), 1700000000);
+
+  EXPECT_TRUE(variable.SetField("value", sup::dto::AnyValue{sup::dto::SignedInteger32Type,
+                                                            kInitialValue + 2}));
+  EXPECT_EQ(m_shared_pv.fetch()["value"].as<int>(), kInitialValue + 2);
+}
+
+//! Server with an array variable created and started before the client.
+//! The client retrieves views on the array, which share the received buffer.
+
+TEST_F(PvAccessClientPVTests, ArrayView)
+{
+  auto pvxs_array_value = pvxs::nt::NTScalar{pvxs::TypeCode::Float64A}.create();
+  pvxs::shared_array<double> initial_array({1.0, 2.0, 3.0});
+  pvxs_array_value["value"] = initial_array.freeze();
+
+  m_server.start();
+  m_shared_pv.open(pvxs_array_value);
+
+  const PvAccessClientPV variable(CreateClientPVImpl(kChannelName));
+  EXPECT_TRUE(variable.GetArrayView<double>().empty());
+
+  EXPECT_TRUE(variable.WaitForValidValue(1.0));
+
+  auto view = variable.GetArrayView<double>();
+  ASSERT_EQ(view.size(), 3u);
+  EXPECT_EQ(view[0], 1.0);
+  EXPECT_EQ(view[1], 2.0);
+  EXPECT_EQ(view[2], 3.0);
+  EXPECT_TRUE(std::equal(view.begin(), view.end(), std::vector<double>{1.0, 2.0, 3.0}.begin()));
+
+  // wrong element type or non-existing field
+  EXPECT_TRUE(variable.GetArrayView<sup::dto::int32>().empty());
+  EXPECT_TRUE(variable.GetArrayView<double>("does_not_exist").empty());
+
+  // posting a new array does not invalidate the existing view
+  auto update = pvxs_array_value.cloneEmpty();
+  pvxs::shared_array<double> new_array({4.0, 5.0});
+  update["value"] = new_array.freeze();
+  m_shared_pv.post(update);
+  EXPECT_TRUE(BusyWaitFor(1.0,
+                          [&variable]() { return variable.GetArrayView<double>().size() == 2u; }));
+  auto new_view = variable.GetArrayView<double>();
+  EXPECT_EQ(new_view[0], 4.0);
+  EXPECT_EQ(new_view[1], 5.0);
+  ASSERT_EQ(view.size(), 3u);
+  EXPECT_EQ(view[2], 3.0);
+}
+
+//! A server with a single variable is created and started before the client.
+//! The server reopens the variable with a type that cannot be converted to the cached value, but
+//! whose leading field still matches. Check that the cached value is left intact.
+
+TEST_F(PvAccessClientPVTests, IncompatibleTypeChange)
+{
+  m_server.start();
+  m_shared_pv.open(m_pvxs_value);
+
+  const PvAccessClientPV variable(CreateClientPVImpl(kChannelName));
+  EXPECT_TRUE(variable.WaitForValidValue(1.0));
+  auto expected = variable.GetValue();
+
+  auto other_value = ::pvxs::TypeDef(::pvxs::TypeCode::Struct,
+                                     {pvxs::members::Int32("value"),
+                                      pvxs::members::String("other")})
+                       .create();
+  other_value["value"] = kInitialValue + 1;
+  other_value["other"] = std::string("incompatible");
+  m_shared_pv.close();
+  EXPECT_TRUE(BusyWaitFor(1.0, [&variable]() { return !variable.IsConnected(); }));
+  m_shared_pv.open(other_value);
+  EXPECT_TRUE(BusyWaitFor(1.0, [&variable]() { return variable.IsConnected(); }));
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  EXPECT_EQ(variable.GetValue(), expected);
+}
+
 //! Server with variable and initial value created before the client.
 //! The client gets the structure from the server, modifies one field, and sets the value back.
 //! Test check that the server value has changed.
@@ -280,6 +631,78 @@ TEST_F(PvAccessClientPVTests, SetFromClient)
                           }));
 }
 
+//! Server with variable and initial value created before the client.
+//! The client sets values asynchronously, with a future and with a completion callback.
+
+TEST_F(PvAccessClientPVTests, SetValueAsyncFromClient)
+{
+  m_server.start();
+  m_shared_pv.open(m_pvxs_value);
+
+  PvAccessClientPV variable(CreateClientPVImpl(kChannelName));
+
+  EXPECT_TRUE(variable.WaitForValidValue(1.0));
+  auto any_value = variable.GetValue();
+
+  any_value["value"] = kInitialValue + 1;
+  auto result = variable.SetValueAsync(any_value);
+  ASSERT_EQ(result.wait_for(std::chrono::seconds(1)), std::future_status::ready);
+  EXPECT_TRUE(result.get());
+  EXPECT_EQ(m_shared_pv.fetch()["value"].as<int>(), kInitialValue + 1);
+
+  std::promise<bool> completed;
+  any_value["value"] = kInitialValue + 2;
+  variable.SetValueAsync(any_value, [&completed](bool success) { completed.set_value(success); });
+  auto completed_result = completed.get_future();
+  ASSERT_EQ(completed_result.wait_for(std::chrono::seconds(1)), std::future_status::ready);
+  EXPECT_TRUE(completed_result.get());
+  EXPECT_EQ(m_shared_pv.fetch()["value"].as<int>(), kInitialValue + 2);
+
+  // incompatible values fail without being sent
+  const sup::dto::AnyValue wrong_value = {{"value", {sup::dto::StringType, "wrong"}},
+                                          {"other", {sup::dto::BooleanType, true}}};
+  auto wrong_result = variable.SetValueAsync(wrong_value);
+  ASSERT_EQ(wrong_result.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+  EXPECT_FALSE(wrong_result.get());
+  EXPECT_NO_THROW(variable.SetValueAsync(wrong_value, {}));
+
+  // a put without callback is not cancelled by the puts that follow it
+  any_value["value"] = kInitialValue + 3;
+  variable.SetValueAsync(any_value, {});
+  any_value["value"] = kInitialValue + 4;
+  EXPECT_TRUE(variable.SetValue(any_value));
+  EXPECT_EQ(m_shared_pv.fetch()["value"].as<int>(), kInitialValue + 4);
+}
+
+//! Server with variable and initial value created before the client.
+//! The client sets a single field, while another field was changed on the server. Only the set
+//! field is sent, so the other change is preserved.
+
+TEST_F(PvAccessClientPVTests, SetFieldFromClient)
+{
+  m_server.start();
+  m_shared_pv.open(m_pvxs_value);
+
+  PvAccessClientPV variable(CreateClientPVImpl(kChannelName));
+
+  EXPECT_TRUE(variable.WaitForValidValue(1.0));
+
+  auto update = m_pvxs_value.cloneEmpty();
+  update["alarm.message"] = std::string("changed on server");
+  m_shared_pv.post(update);
+
+  EXPECT_TRUE(variable.SetField("value", sup::dto::AnyValue{sup::dto::SignedInteger32Type,
+                                                            kInitialValue + 1}));
+  auto shared_value = m_shared_pv.fetch();
+  EXPECT_EQ(shared_value["value"].as<int>(), kInitialValue + 1);
+  EXPECT_EQ(shared_value["alarm.status"].as<int>(), kInitialStatus);
+  EXPECT_EQ(shared_value["alarm.message"].as<std::string>(), std::string("changed on server"));
+
+  // non-existing fields or incompatible values are not sent
+  EXPECT_FALSE(variable.SetField("non_existing", sup::dto::AnyValue{sup::dto::BooleanType, true}));
+  EXPECT_FALSE(variable.SetField("value", sup::dto::AnyValue{sup::dto::StringType, "abc"}));
+}
+
 //! Server with variable and initial value created before the client.
 //! The client gets the structure from the server and sets the value of one field three times in a
 //! row without any extra delays. This led to the situation, where every next operation, destroys
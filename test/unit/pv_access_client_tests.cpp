@@ -29,10 +29,14 @@
 #include <sup/dto/anytype.h>
 #include <sup/dto/anyvalue.h>
 #include <sup/epics/pv_access_client.h>
+#include <sup/epics/pv_access_client_context.h>
 #include <sup/epics/pvxs/pv_access_client_impl.h>
+#include <sup/epics/pvxs/pv_access_utils.h>
 #include <sup/epics/utils/dto_conversion_utils.h>
 
+#include <chrono>
 #include <stdexcept>
+#include <thread>
 
 #include <sup/epics-test/unit_test_helper.h>
 
@@ -108,6 +112,7 @@ TEST_F(PvAccessClientTest, InitialState)
   EXPECT_THROW(client.GetExtendedValue("non-existing-channel"), std::runtime_error);
   const sup::dto::AnyValue any_value;
   EXPECT_THROW(client.SetValue("non-existing-channel", any_value), std::runtime_error);
+  EXPECT_THROW(client.SetValues({{"non-existing-channel", any_value}}, 1.0), std::runtime_error);
   EXPECT_THROW(client.WaitForConnected("non-existing-channel", 1.0), std::runtime_error);
   EXPECT_THROW(client.WaitForValidValue("non-existing-channel", 1.0), std::runtime_error);
 }
@@ -196,6 +201,111 @@ TEST_F(PvAccessClientTest, TwoDifferentChannels)
                           }));
 }
 
+//! Server with two different variables was created and started before the client. Both values
+//! are set with a single batched put.
+
+TEST_F(PvAccessClientTest, SetValuesOfTwoChannels)
+{
+  m_server.start();
+  m_shared_ntscalar_pv.open(m_pvxs_ntscalar_value);
+  m_shared_string_pv.open(m_pvxs_string_value);
+
+  sup::epics::PvAccessClient client(CreateClientImpl());
+  client.AddVariable(kIntChannelName);
+  client.AddVariable(kStringChannelName);
+
+  EXPECT_TRUE(client.WaitForValidValue(kIntChannelName, 1.0));
+  EXPECT_TRUE(client.WaitForValidValue(kStringChannelName, 1.0));
+
+  auto any_value0 = client.GetValue(kIntChannelName);
+  any_value0["value"] = kInitialIntChannelValue + 1;
+  auto any_value1 = client.GetValue(kStringChannelName);
+  any_value1["value"] = std::string("abc2");
+  EXPECT_TRUE(client.SetValues({{kIntChannelName, any_value0}, {kStringChannelName, any_value1}},
+                               1.0));
+
+  EXPECT_EQ(m_shared_ntscalar_pv.fetch()["value"].as<int>(), kInitialIntChannelValue + 1);
+  EXPECT_EQ(m_shared_string_pv.fetch()["value"].as<std::string>(), std::string("abc2"));
+
+  // a single invalid value fails the whole batch, without writing any of the values
+  any_value0["value"] = kInitialIntChannelValue + 2;
+  const sup::dto::AnyValue wrong_value = {{"value", {sup::dto::StringType, "not a struct field"}},
+                                          {"other", {sup::dto::BooleanType, true}}};
+  EXPECT_FALSE(client.SetValues({{kIntChannelName, any_value0}, {kStringChannelName, wrong_value}},
+                                1.0));
+  const sup::dto::AnyValue scalar_value{sup::dto::SignedInteger32Type, 0};
+  EXPECT_THROW(client.SetValues({{kIntChannelName, any_value0}, {kStringChannelName, scalar_value}},
+                                1.0), std::runtime_error);
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_EQ(m_shared_ntscalar_pv.fetch()["value"].as<int>(), kInitialIntChannelValue + 1);
+}
+
+//! Server with two different variables was created and started before the client. The values are
+//! read with one-shot gets, without adding variables to the client.
+
+TEST_F(PvAccessClientTest, GetAndGetMany)
+{
+  m_server.start();
+  m_shared_ntscalar_pv.open(m_pvxs_ntscalar_value);
+  m_shared_string_pv.open(m_pvxs_string_value);
+
+  sup::epics::PvAccessClient client(CreateClientImpl());
+
+  auto int_value = client.Get(kIntChannelName, 1.0);
+  ASSERT_TRUE(int_value.HasField("value"));
+  EXPECT_EQ(int_value["value"], kInitialIntChannelValue);
+  EXPECT_TRUE(client.GetVariableNames().empty());
+
+  const std::string unknown_channel = "PVXS-TESTS:UNKNOWN";
+  auto values = client.GetMany({kIntChannelName, kStringChannelName, unknown_channel}, 1.0);
+  ASSERT_EQ(values.size(), 3u);
+  EXPECT_EQ(values[kIntChannelName]["value"], kInitialIntChannelValue);
+  EXPECT_EQ(values[kStringChannelName]["value"], kInitialStringChannelValue);
+  EXPECT_TRUE(::sup::dto::IsEmptyValue(values[unknown_channel]));
+
+  EXPECT_TRUE(::sup::dto::IsEmptyValue(client.Get(unknown_channel, 0.1)));
+
+  // only the selected fields are read
+  auto selected_value = client.Get(kIntChannelName, 1.0, "value");
+  ASSERT_TRUE(selected_value.HasField("value"));
+  EXPECT_EQ(selected_value["value"], kInitialIntChannelValue);
+  EXPECT_FALSE(selected_value.HasField("alarm"));
+  values = client.GetMany({kIntChannelName, kStringChannelName}, 1.0, "value");
+  EXPECT_FALSE(values[kIntChannelName].HasField("alarm"));
+  EXPECT_EQ(values[kStringChannelName]["value"], kInitialStringChannelValue);
+}
+
+//! Server with a variable was created and started before the client. The client and its variable
+//! use a named client context.
+
+TEST_F(PvAccessClientTest, NamedContext)
+{
+  m_server.start();
+  m_shared_ntscalar_pv.open(m_pvxs_ntscalar_value);
+
+  const std::string context_name = "PvAccessClientTest:NamedContext";
+  EXPECT_FALSE(sup::epics::HasPvAccessClientContext(context_name));
+  sup::epics::utils::RegisterClientContext(
+      context_name, std::make_shared<pvxs::client::Context>(m_server.clientConfig().build()));
+  EXPECT_TRUE(sup::epics::HasPvAccessClientContext(context_name));
+  EXPECT_THROW(sup::epics::CreatePvAccessClientContext(
+                   context_name, sup::epics::GetDefaultClientContextConfig()),
+               std::runtime_error);
+  EXPECT_THROW(sup::epics::PvAccessClient("PvAccessClientTest:UnknownContext", {}),
+               std::runtime_error);
+
+  sup::epics::PvAccessClient client(context_name, {});
+  EXPECT_EQ(client.Get(kIntChannelName, 1.0)["value"], kInitialIntChannelValue);
+
+  // variable with explicit context in its configuration, from a client using the shared context
+  sup::epics::PvAccessClient other_client;
+  auto config = sup::epics::GetDefaultClientPVConfig();
+  config.context_name = context_name;
+  other_client.AddVariable(kIntChannelName, config);
+  EXPECT_TRUE(other_client.WaitForValidValue(kIntChannelName, 1.0));
+  EXPECT_EQ(other_client.GetValue(kIntChannelName)["value"], kInitialIntChannelValue);
+}
+
 TEST_F(PvAccessClientTest, Move)
 {
   // starting a server with two variables
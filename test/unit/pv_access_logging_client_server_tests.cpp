@@ -21,6 +21,7 @@
 #include <sup/epics-test/unit_test_helper.h>
 #include <sup/epics/epics_protocol_factory.h>
 #include <sup/epics/pv_access_rpc_client.h>
+#include <sup/epics/pv_access_rpc_server.h>
 #include <sup/protocol/log_any_functor_decorator.h>
 
 #include <gtest/gtest.h>
@@ -70,7 +71,7 @@ TEST_F(PvAccessLoggingClientServerTests, PacketLogging)
       {{"counter", {sup::dto::UnsignedInteger16Type, 42u}}, {"message", "ok"}}};
   test::FixedReplyFunctor fixed_reply_functor(reply);
   const std::string server_name = "LoggingClientServerTest::Server";
-  const sup::epics::PvAccessRPCServerConfig server_config{server_name};
+  const auto server_config = sup::epics::GetDefaultRPCServerConfig(server_name);
   auto client_config = sup::epics::GetDefaultRPCClientConfig(server_name);
   auto server =
       CreateLoggingEPICSRPCServer(server_config, fixed_reply_functor, server_log_function);
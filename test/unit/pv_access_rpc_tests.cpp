@@ -27,9 +27,14 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <functional>
+#include <future>
+#include <thread>
+#include <vector>
 
 static const std::string RETURN_EMPTY_FIELD = "return_empty";
+static const std::string DELAY_FIELD = "delay";
 
 using namespace sup::epics;
 
@@ -43,10 +48,17 @@ protected:
 
   sup::dto::AnyFunctor& GetHandler();
 
+  //! Handler that replies with success after the delay in seconds found in the request, if any.
+  sup::dto::AnyFunctor& GetDelayHandler();
+
+  //! Creates a request with a scalar payload and the delay for the delay handler.
+  sup::dto::AnyValue CreateDelayedRequest(double delay) const;
+
   std::unique_ptr<sup::dto::AnyValue> m_request;
   std::unique_ptr<sup::dto::AnyValue> m_reply;
 private:
   test::FunctionFunctor m_handler;
+  test::FunctionFunctor m_delay_handler;
 };
 
 //! Standard scenario. Single server and single client.
@@ -128,7 +140,9 @@ TEST_F(PvAccessRPCTests, RPCClientWrongChannel)
   const std::string channel_name = "PvAccessRPCTests:channel";
   PvAccessRPCServer server(PvAccessRPCServer::Isolated, GetDefaultRPCServerConfig(channel_name),
                            GetHandler());
-  auto client = server.CreateClient({"DOESNOTEXIST", 0.1});
+  auto client_config = GetDefaultRPCClientConfig("DOESNOTEXIST");
+  client_config.timeout = 0.1;
+  auto client = server.CreateClient(client_config);
 
   const sup::dto::AnyValue payload{42};
   auto request =
@@ -213,7 +227,9 @@ TEST_F(PvAccessRPCTests, ServerDestructionAndReconstruction)
   for (std::size_t i=0; i<n_times; ++i)
   {
     PvAccessRPCServer server(GetDefaultRPCServerConfig(channel_name), GetHandler());
-    PvAccessRPCClient client(PvAccessRPCClientConfig{channel_name, 10.0});
+    auto client_config = GetDefaultRPCClientConfig(channel_name);
+    client_config.timeout = 10.0;
+    PvAccessRPCClient client(client_config);
 
     // Send simple scalar payload over RPC
     const sup::dto::AnyValue payload{42};
@@ -228,6 +244,178 @@ TEST_F(PvAccessRPCTests, ServerDestructionAndReconstruction)
   }
 }
 
+//! A slow request does not block fast requests when the server uses handler threads.
+
+TEST_F(PvAccessRPCTests, SlowAndFastRequests)
+{
+  const std::string channel_name = "PvAccessRPCTests:channel";
+  auto server_config = GetDefaultRPCServerConfig(channel_name);
+  server_config.handler_threads = 2;
+  PvAccessRPCServer server(PvAccessRPCServer::Isolated, server_config, GetDelayHandler());
+  auto slow_client = server.CreateClient(GetDefaultRPCClientConfig(channel_name));
+  auto fast_client = server.CreateClient(GetDefaultRPCClientConfig(channel_name));
+
+  auto fast_request = CreateDelayedRequest(0.0);
+  auto slow_request = CreateDelayedRequest(2.0);
+
+  auto slow_reply = std::async(std::launch::async,
+                               [&]() { return slow_client(slow_request); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  // All fast requests are handled by the second thread while the slow one is running.
+  const std::size_t n_fast = 20;
+  for (std::size_t i = 0; i < n_fast; ++i)
+  {
+    auto reply = fast_client(fast_request);
+    ASSERT_TRUE(sup::protocol::utils::CheckReplyFormat(reply));
+    EXPECT_EQ(reply[sup::protocol::constants::REPLY_RESULT].As<unsigned int>(),
+              sup::protocol::Success.GetValue());
+  }
+  EXPECT_EQ(slow_reply.wait_for(std::chrono::seconds(0)), std::future_status::timeout);
+  auto reply = slow_reply.get();
+  ASSERT_TRUE(sup::protocol::utils::CheckReplyFormat(reply));
+  EXPECT_EQ(reply[sup::protocol::constants::REPLY_RESULT].As<unsigned int>(),
+            sup::protocol::Success.GetValue());
+}
+
+//! Requests that exceed the admission limits are rejected immediately with the ServerBusy result.
+
+TEST_F(PvAccessRPCTests, AdmissionControl)
+{
+  const std::string channel_name = "PvAccessRPCTests:channel";
+  auto server_config = GetDefaultRPCServerConfig(channel_name);
+  server_config.handler_threads = 1;
+  server_config.max_pending_requests = 1;
+  PvAccessRPCServer server(PvAccessRPCServer::Isolated, server_config, GetDelayHandler());
+  auto slow_client_1 = server.CreateClient(GetDefaultRPCClientConfig(channel_name));
+  auto slow_client_2 = server.CreateClient(GetDefaultRPCClientConfig(channel_name));
+  auto fast_client = server.CreateClient(GetDefaultRPCClientConfig(channel_name));
+
+  auto fast_request = CreateDelayedRequest(0.0);
+  auto slow_request = CreateDelayedRequest(1.0);
+
+  // The first slow request occupies the handler thread and the second one the pending queue.
+  auto slow_reply_1 = std::async(std::launch::async,
+                                 [&]() { return slow_client_1(slow_request); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  auto slow_reply_2 = std::async(std::launch::async,
+                                 [&]() { return slow_client_2(slow_request); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  auto reply = fast_client(fast_request);
+  ASSERT_TRUE(sup::protocol::utils::CheckReplyFormat(reply));
+  EXPECT_EQ(reply[sup::protocol::constants::REPLY_RESULT].As<unsigned int>(),
+            ServerBusy.GetValue());
+  EXPECT_EQ(slow_reply_1.get()[sup::protocol::constants::REPLY_RESULT].As<unsigned int>(),
+            sup::protocol::Success.GetValue());
+  EXPECT_EQ(slow_reply_2.get()[sup::protocol::constants::REPLY_RESULT].As<unsigned int>(),
+            sup::protocol::Success.GetValue());
+  auto counters = server.GetCounters();
+  EXPECT_EQ(counters.accepted, 2u);
+  EXPECT_EQ(counters.rejected, 1u);
+
+  // Once the server is idle again, requests are accepted.
+  reply = fast_client(fast_request);
+  EXPECT_EQ(reply[sup::protocol::constants::REPLY_RESULT].As<unsigned int>(),
+            sup::protocol::Success.GetValue());
+}
+
+//! The in-flight limit rejects requests, even when handler threads are available.
+
+TEST_F(PvAccessRPCTests, InFlightLimit)
+{
+  const std::string channel_name = "PvAccessRPCTests:channel";
+  auto server_config = GetDefaultRPCServerConfig(channel_name);
+  server_config.handler_threads = 2;
+  server_config.max_in_flight_requests = 1;
+  PvAccessRPCServer server(PvAccessRPCServer::Isolated, server_config, GetDelayHandler());
+  auto client_1 = server.CreateClient(GetDefaultRPCClientConfig(channel_name));
+  auto client_2 = server.CreateClient(GetDefaultRPCClientConfig(channel_name));
+
+  auto request = CreateDelayedRequest(0.5);
+  auto reply_1 = std::async(std::launch::async, [&]() { return client_1(request); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  auto reply_2 = client_2(request);
+  EXPECT_EQ(reply_2[sup::protocol::constants::REPLY_RESULT].As<unsigned int>(),
+            ServerBusy.GetValue());
+  EXPECT_EQ(reply_1.get()[sup::protocol::constants::REPLY_RESULT].As<unsigned int>(),
+            sup::protocol::Success.GetValue());
+  auto counters = server.GetCounters();
+  EXPECT_EQ(counters.accepted, 1u);
+  EXPECT_EQ(counters.rejected, 1u);
+}
+
+//! Many asynchronous calls of a single client are in flight at the same time.
+
+TEST_F(PvAccessRPCTests, AsyncCalls)
+{
+  const std::string channel_name = "PvAccessRPCTests:channel";
+  auto server_config = GetDefaultRPCServerConfig(channel_name);
+  server_config.handler_threads = 4;
+  PvAccessRPCServer server(PvAccessRPCServer::Isolated, server_config, GetDelayHandler());
+  auto client = server.CreateClient(GetDefaultRPCClientConfig(channel_name));
+
+  auto request = CreateDelayedRequest(1.0);
+
+  // With one call at a time, this would take at least four seconds.
+  const std::size_t n_calls = 4;
+  std::vector<std::future<sup::dto::AnyValue>> replies;
+  for (std::size_t i = 0; i < n_calls; ++i)
+  {
+    replies.push_back(client.CallAsync(request));
+  }
+  for (auto& reply : replies)
+  {
+    ASSERT_EQ(reply.wait_for(std::chrono::seconds(3)), std::future_status::ready);
+    auto value = reply.get();
+    ASSERT_TRUE(sup::protocol::utils::CheckReplyFormat(value));
+    EXPECT_EQ(value[sup::protocol::constants::REPLY_RESULT].As<unsigned int>(),
+              sup::protocol::Success.GetValue());
+  }
+
+  // Empty requests are answered immediately with an empty value.
+  auto empty_reply = client.CallAsync(sup::dto::AnyValue{}).get();
+  EXPECT_TRUE(sup::dto::IsEmptyValue(empty_reply));
+}
+
+//! Asynchronous calls time out independently of each other.
+
+TEST_F(PvAccessRPCTests, AsyncCallTimeout)
+{
+  const std::string channel_name = "PvAccessRPCTests:channel";
+  auto server_config = GetDefaultRPCServerConfig(channel_name);
+  server_config.handler_threads = 2;
+  PvAccessRPCServer server(PvAccessRPCServer::Isolated, server_config, GetDelayHandler());
+  auto client = server.CreateClient(GetDefaultRPCClientConfig(channel_name));
+
+  auto request = CreateDelayedRequest(0.5);
+
+  auto short_reply = client.CallAsync(request, 0.1);
+  std::promise<sup::dto::AnyValue> promise;
+  client.CallAsync(request, 5.0,
+                   [&promise](const sup::dto::AnyValue& reply) { promise.set_value(reply); });
+  auto long_reply = promise.get_future();
+
+  auto reply = short_reply.get();
+  ASSERT_TRUE(sup::protocol::utils::CheckReplyFormat(reply));
+  EXPECT_EQ(reply[sup::protocol::constants::REPLY_RESULT].As<unsigned int>(),
+            sup::protocol::NotConnected.GetValue());
+  EXPECT_EQ(long_reply.wait_for(std::chrono::seconds(0)), std::future_status::timeout);
+  reply = long_reply.get();
+  ASSERT_TRUE(sup::protocol::utils::CheckReplyFormat(reply));
+  EXPECT_EQ(reply[sup::protocol::constants::REPLY_RESULT].As<unsigned int>(),
+            sup::protocol::Success.GetValue());
+
+  // Calls that are still in flight when the client is destroyed are answered as not connected.
+  {
+    auto other_client = server.CreateClient(GetDefaultRPCClientConfig(channel_name));
+    short_reply = other_client.CallAsync(request);
+  }
+  reply = short_reply.get();
+  EXPECT_EQ(reply[sup::protocol::constants::REPLY_RESULT].As<unsigned int>(),
+            sup::protocol::NotConnected.GetValue());
+}
+
 PvAccessRPCTests::PvAccessRPCTests()
   : m_request{}
   , m_reply{}
@@ -235,6 +423,14 @@ PvAccessRPCTests::PvAccessRPCTests()
       m_request = std::make_unique<sup::dto::AnyValue>(request);
       m_reply = std::make_unique<sup::dto::AnyValue>(reply);
     }}
+  , m_delay_handler{[](const sup::dto::AnyValue& request, sup::dto::AnyValue& reply){
+      if (request.HasField(DELAY_FIELD))
+      {
+        std::this_thread::sleep_for(
+          std::chrono::duration<double>(request[DELAY_FIELD].As<double>()));
+      }
+      reply = sup::protocol::utils::CreateRPCReply(sup::protocol::Success);
+    }}
 {}
 
 PvAccessRPCTests::~PvAccessRPCTests() = default;
@@ -243,3 +439,17 @@ sup::dto::AnyFunctor& PvAccessRPCTests::GetHandler()
 {
   return m_handler;
 }
+
+sup::dto::AnyFunctor& PvAccessRPCTests::GetDelayHandler()
+{
+  return m_delay_handler;
+}
+
+sup::dto::AnyValue PvAccessRPCTests::CreateDelayedRequest(double delay) const
+{
+  const sup::dto::AnyValue payload{42};
+  auto request =
+    sup::protocol::utils::CreateRPCRequest(payload, sup::protocol::PayloadEncoding::kNone);
+  request.AddMember(DELAY_FIELD, delay);
+  return request;
+}
@@ -28,9 +28,13 @@
 #include <sup/epics/pvxs/pv_access_utils.h>
 
 #include <gtest/gtest.h>
+#include <pvxs/client.h>
 #include <pvxs/server.h>
 #include <pvxs/sharedpv.h>
 
+#include <mutex>
+#include <vector>
+
 using sup::epics::test::BusyWaitFor;
 using sup::epics::test::GetPvGetOutput;
 using sup::epics::test::PvPut;
@@ -137,6 +141,85 @@ TEST_F(PvAccessServerPVTests, GetAndSetForIsolatedServerWithCallbacks)
   EXPECT_TRUE(BusyWaitFor(1.0, [&]() { return variable.GetValue() == new_any_value; }));
 }
 
+//! Setting a value where a single field changed. A client monitoring the variable only receives
+//! this field marked as changed.
+
+TEST_F(PvAccessServerPVTests, DeltaUpdates)
+{
+  auto server = utils::CreateIsolatedServer();
+  server->start();
+
+  const std::string variable_name{"variable_name"};
+  const sup::dto::AnyValue any_value = {{"first", {sup::dto::SignedInteger32Type, 1}},
+                                        {"second", {sup::dto::Float64Type, 2.0}}};
+  PvAccessServerPV variable(variable_name, any_value, {});
+  variable.AddToServer(*server);
+
+  auto context = server->clientConfig().build();
+  auto subscription =
+      context.monitor(variable_name).maskConnected(true).maskDisconnected(true).exec();
+
+  // initial update contains all fields
+  pvxs::Value update;
+  EXPECT_TRUE(BusyWaitFor(1.0, [&]() { return bool(update = subscription->pop()); }));
+  EXPECT_TRUE(update["first"].isMarked());
+  EXPECT_TRUE(update["second"].isMarked());
+
+  auto new_any_value = any_value;
+  new_any_value["second"] = 3.0;
+  EXPECT_TRUE(variable.SetValue(new_any_value));
+  EXPECT_EQ(variable.GetValue(), new_any_value);
+
+  EXPECT_TRUE(BusyWaitFor(1.0, [&]() { return bool(update = subscription->pop()); }));
+  EXPECT_FALSE(update["first"].isMarked());
+  EXPECT_TRUE(update["second"].isMarked());
+  EXPECT_EQ(update["second"].as<double>(), 3.0);
+}
+
+//! A client put that only sends one field. The other fields keep their value and the callback is
+//! called once with the complete value.
+
+TEST_F(PvAccessServerPVTests, PartialPut)
+{
+  auto server = utils::CreateIsolatedServer();
+  server->start();
+
+  const std::string variable_name{"variable_name"};
+  const sup::dto::AnyValue any_value = {{"first", {sup::dto::SignedInteger32Type, 1}},
+                                        {"second", {sup::dto::Float64Type, 2.0}}};
+  std::vector<sup::dto::AnyValue> callback_values;
+  std::mutex callback_mtx;
+  auto callback = [&](const sup::dto::AnyValue& value)
+  {
+    std::lock_guard<std::mutex> lk(callback_mtx);
+    callback_values.push_back(value);
+  };
+  PvAccessServerPV variable(variable_name, any_value, callback);
+  variable.AddToServer(*server);
+
+  auto context = server->clientConfig().build();
+  (void)context.put(variable_name).set("second", 4.0).exec()->wait(1.0);
+
+  auto expected_value = any_value;
+  expected_value["second"] = 4.0;
+  EXPECT_EQ(variable.GetValue(), expected_value);
+  {
+    std::lock_guard<std::mutex> lk(callback_mtx);
+    ASSERT_EQ(callback_values.size(), 1u);
+    EXPECT_EQ(callback_values[0], expected_value);
+  }
+
+  // later updates start from the value of the put
+  expected_value["first"] = 5;
+  auto update = variable.GetValue();
+  update["first"] = 5;
+  EXPECT_TRUE(variable.SetValue(update));
+  EXPECT_EQ(variable.GetValue(), expected_value);
+  auto result = context.get(variable_name).exec()->wait(1.0);
+  EXPECT_EQ(result["first"].as<sup::dto::int32>(), 5);
+  EXPECT_EQ(result["second"].as<double>(), 4.0);
+}
+
 //! Adding variable to a server. Server is started first.
 
 TEST_F(PvAccessServerPVTests, AddToServerAfterServerStart)
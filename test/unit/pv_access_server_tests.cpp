@@ -28,6 +28,10 @@
 #include <gtest/gtest.h>
 #include <pvxs/server.h>
 
+#include <atomic>
+#include <memory>
+#include <thread>
+
 using sup::epics::test::BusyWaitFor;
 using sup::epics::test::GetPvGetOutput;
 using sup::epics::test::PvPut;
@@ -81,6 +85,223 @@ TEST_F(PVAccessServerTests, AddVariableAndGetSetWithoutRunning)
   EXPECT_EQ(server.GetValue("channel0"), new_any_value);
 }
 
+//! Add and remove variables after the server was started. Clients of the other variables stay
+//! connected.
+
+TEST_F(PVAccessServerTests, AddAndRemoveVariableWhileRunning)
+{
+  PvAccessServer server(PvAccessServer::Isolated);
+  const sup::dto::AnyValue any_value0({{"value", {sup::dto::SignedInteger32Type, 42}}});
+  server.AddVariable("channel0", any_value0);
+  server.Start();
+
+  auto client = server.CreateClient();
+  client.AddVariable("channel0");
+  EXPECT_TRUE(client.WaitForValidValue("channel0", 1.0));
+
+  // adding a variable to the running server
+  const sup::dto::AnyValue any_value1({{"value", {sup::dto::SignedInteger32Type, 43}}});
+  server.AddVariable("channel1", any_value1);
+  client.AddVariable("channel1");
+  EXPECT_TRUE(client.WaitForValidValue("channel1", 1.0));
+  EXPECT_EQ(client.GetValue("channel1"), any_value1);
+
+  // removing the first variable only disconnects its client
+  server.RemoveVariable("channel0");
+  EXPECT_EQ(server.GetVariableNames(), std::vector<std::string>({"channel1"}));
+  EXPECT_THROW(server.RemoveVariable("channel0"), std::runtime_error);
+  EXPECT_TRUE(BusyWaitFor(1.0, [&]() { return !client.IsConnected("channel0"); }));
+  EXPECT_TRUE(client.IsConnected("channel1"));
+
+  const sup::dto::AnyValue new_any_value({{"value", {sup::dto::SignedInteger32Type, 44}}});
+  EXPECT_TRUE(server.SetValue("channel1", new_any_value));
+  EXPECT_TRUE(BusyWaitFor(1.0, [&]() { return client.GetValue("channel1") == new_any_value; }));
+
+  // a removed variable can be added again
+  server.AddVariable("channel0", any_value0);
+  EXPECT_TRUE(client.WaitForValidValue("channel0", 2.0));
+  EXPECT_EQ(client.GetValue("channel0"), any_value0);
+}
+
+//! Add and remove a variable while another thread keeps setting and getting its value.
+
+TEST_F(PVAccessServerTests, AddAndRemoveVariableWhileSetting)
+{
+  PvAccessServer server(PvAccessServer::Isolated);
+  const sup::dto::AnyValue any_value({{"value", {sup::dto::SignedInteger32Type, 42}}});
+  server.Start();
+
+  std::atomic<bool> done{false};
+  std::thread producer([&]()
+    {
+      while (!done)
+      {
+        try
+        {
+          (void)server.SetValue("channel", any_value);
+          (void)server.GetValue("channel");
+        }
+        catch (const std::runtime_error&)
+        {
+          // the variable was not added at this time
+        }
+      }
+    });
+  const std::size_t n_times = 100;
+  for (std::size_t i = 0; i < n_times; ++i)
+  {
+    server.AddVariable("channel", any_value);
+    server.RemoveVariable("channel");
+  }
+  done = true;
+  producer.join();
+  EXPECT_TRUE(server.GetVariableNames().empty());
+}
+
+//! Set the values of multiple variables as a group. When one of the values can not be set, none
+//! of the variables is changed.
+
+TEST_F(PVAccessServerTests, SetValues)
+{
+  MockListener listener;
+  PvAccessServer server(PvAccessServer::Isolated, listener.GetServerCallBack());
+  const sup::dto::AnyValue any_value0({{"value", {sup::dto::SignedInteger32Type, 42}}});
+  const sup::dto::AnyValue any_value1 = {{"signed", {sup::dto::SignedInteger32Type, 42}},
+                                         {"bool", {sup::dto::BooleanType, true}}};
+  server.AddVariable("channel0", any_value0);
+  server.AddVariable("channel1", any_value1);
+  server.Start();
+
+  auto client = server.CreateClient();
+  client.AddVariable("channel0");
+  client.AddVariable("channel1");
+  EXPECT_TRUE(client.WaitForValidValue("channel0", 1.0));
+  EXPECT_TRUE(client.WaitForValidValue("channel1", 1.0));
+
+  const sup::dto::AnyValue new_any_value0({{"value", {sup::dto::SignedInteger32Type, 43}}});
+  const sup::dto::AnyValue new_any_value1 = {{"signed", {sup::dto::SignedInteger32Type, 44}},
+                                             {"bool", {sup::dto::BooleanType, false}}};
+  EXPECT_CALL(listener, OnServerValueChanged("channel0", new_any_value0)).Times(1);
+  EXPECT_CALL(listener, OnServerValueChanged("channel1", new_any_value1)).Times(1);
+  EXPECT_TRUE(server.SetValues({{"channel0", new_any_value0}, {"channel1", new_any_value1}}));
+  EXPECT_EQ(server.GetValue("channel0"), new_any_value0);
+  EXPECT_EQ(server.GetValue("channel1"), new_any_value1);
+  EXPECT_TRUE(BusyWaitFor(1.0,
+                          [&]()
+                          {
+                            return client.GetValue("channel0") == new_any_value0
+                                   && client.GetValue("channel1") == new_any_value1;
+                          }));
+  testing::Mock::VerifyAndClearExpectations(&listener);
+
+  // unknown channel or incompatible value: no variable is changed
+  EXPECT_CALL(listener, OnServerValueChanged(_, _)).Times(0);
+  EXPECT_THROW(server.SetValues({{"channel0", any_value0}, {"unknown", any_value0}}),
+               std::runtime_error);
+  EXPECT_THROW(server.SetValues({{"channel0", any_value0}, {"channel1", any_value0}}),
+               sup::dto::InvalidConversionException);
+  EXPECT_EQ(server.GetValue("channel0"), new_any_value0);
+  EXPECT_EQ(server.GetValue("channel1"), new_any_value1);
+}
+
+//! Publishing an array field without copying it. The server's value follows the published
+//! array and clients receive it.
+
+TEST_F(PVAccessServerTests, SetArray)
+{
+  MockListener listener;
+  PvAccessServer server(PvAccessServer::Isolated, listener.GetServerCallBack());
+  const sup::dto::AnyValue any_value = {
+    {"value", sup::dto::ArrayValue({{sup::dto::Float64Type, 0.0}, 0.0, 0.0})},
+    {"id", {sup::dto::UnsignedInteger32Type, 1}}};
+  server.AddVariable("channel", any_value);
+  server.Start();
+
+  auto client = server.CreateClient();
+  client.AddVariable("channel");
+  EXPECT_TRUE(client.WaitForValidValue("channel", 1.0));
+
+  std::shared_ptr<const double> data(new double[3]{1.0, 2.0, 3.0},
+                                     std::default_delete<const double[]>());
+  const PvAccessArrayView<double> array(data, 3);
+  auto expected_value = any_value;
+  expected_value["value"] = sup::dto::ArrayValue({{sup::dto::Float64Type, 1.0}, 2.0, 3.0});
+  EXPECT_CALL(listener, OnServerValueChanged("channel", expected_value)).Times(1);
+  EXPECT_TRUE(server.SetArray("channel", array));
+  EXPECT_EQ(server.GetValue("channel"), expected_value);
+  EXPECT_TRUE(
+    BusyWaitFor(1.0, [&]() { return client.GetValue("channel") == expected_value; }));
+  testing::Mock::VerifyAndClearExpectations(&listener);
+
+  // a later update of another field keeps the published array
+  expected_value["id"] = 2u;
+  auto update = server.GetValue("channel");
+  update["id"] = 2u;
+  EXPECT_CALL(listener, OnServerValueChanged("channel", expected_value)).Times(1);
+  EXPECT_TRUE(server.SetValue("channel", update));
+  EXPECT_EQ(server.GetValue("channel"), expected_value);
+  EXPECT_TRUE(
+    BusyWaitFor(1.0, [&]() { return client.GetValue("channel") == expected_value; }));
+  testing::Mock::VerifyAndClearExpectations(&listener);
+
+  // wrong element type, size, field or channel
+  EXPECT_CALL(listener, OnServerValueChanged(_, _)).Times(0);
+  std::shared_ptr<const sup::dto::int32> int_data(new sup::dto::int32[3]{1, 2, 3},
+                                                  std::default_delete<const sup::dto::int32[]>());
+  EXPECT_THROW(server.SetArray("channel", PvAccessArrayView<sup::dto::int32>(int_data, 3)),
+               std::runtime_error);
+  EXPECT_THROW(server.SetArray("channel", PvAccessArrayView<double>(data, 2)),
+               std::runtime_error);
+  EXPECT_THROW(server.SetArray("channel", array, "id"), std::runtime_error);
+  EXPECT_THROW(server.SetArray("unknown", array), std::runtime_error);
+  EXPECT_EQ(server.GetValue("channel"), expected_value);
+}
+
+//! Rate limited variable: updates that come too fast are conflated, while the server's value
+//! stays up to date and the client eventually receives the latest value.
+
+TEST_F(PVAccessServerTests, MaxPostRate)
+{
+  PvAccessServer server(PvAccessServer::Isolated);
+  PvAccessServerPVConfig config = GetDefaultServerPVConfig();
+  config.max_post_rate = 5.0;
+  EXPECT_EQ(GetDefaultServerPVConfig().max_post_rate, 0.0);
+  config.max_post_rate = -1.0;
+  EXPECT_THROW(server.AddVariable("channel", {sup::dto::SignedInteger32Type, 0}, config),
+               std::runtime_error);
+  config.max_post_rate = 5.0;
+  server.AddVariable("channel", {{"value", {sup::dto::SignedInteger32Type, 0}}}, config);
+  server.Start();
+
+  auto client = server.CreateClient();
+  client.AddVariable("channel");
+  EXPECT_TRUE(client.WaitForValidValue("channel", 1.0));
+
+  const sup::dto::int32 n_updates = 20;
+  for (sup::dto::int32 i = 1; i <= n_updates; ++i)
+  {
+    const sup::dto::AnyValue update({{"value", {sup::dto::SignedInteger32Type, i}}});
+    EXPECT_TRUE(server.SetValue("channel", update));
+    EXPECT_EQ(server.GetValue("channel"), update);
+  }
+  auto counters = server.GetPostCounters("channel");
+  EXPECT_GT(counters.dropped, 0);
+  EXPECT_LT(counters.posted, n_updates);
+
+  const sup::dto::AnyValue last_value({{"value", {sup::dto::SignedInteger32Type, n_updates}}});
+  EXPECT_TRUE(BusyWaitFor(2.0, [&]() { return client.GetValue("channel") == last_value; }));
+  counters = server.GetPostCounters("channel");
+  EXPECT_EQ(counters.posted + counters.dropped, n_updates);
+
+  // client puts go through the same rate limiting
+  const sup::dto::AnyValue put_value({{"value", {sup::dto::SignedInteger32Type, 0}}});
+  EXPECT_TRUE(client.SetValue("channel", put_value));
+  EXPECT_TRUE(BusyWaitFor(2.0, [&]() { return client.GetValue("channel") == put_value; }));
+  counters = server.GetPostCounters("channel");
+  EXPECT_EQ(counters.posted + counters.dropped, n_updates + 1);
+  EXPECT_THROW(server.GetPostCounters("unknown"), std::runtime_error);
+}
+
 //! Standard scenario. Add single variable and start server.
 //! Check value via `pvget`, change value via `pvput` and check on server side.
 
@@ -0,0 +1,111 @@
+/******************************************************************************
+ *
+ * Project       : Supervision and automation system EPICS interface
+ *
+ * Description   : Library of SUP components for EPICS network protocol
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include <sup/dto/anyvalue.h>
+#include <sup/dto/anyvalue_helper.h>
+#include <sup/epics/utils/dto_conversion_utils.h>
+#include <sup/epics/utils/pvxs_update_plan.h>
+
+#include <gtest/gtest.h>
+#include <pvxs/data.h>
+
+using namespace ::sup::epics;
+
+class PvxsUpdatePlanTests : public ::testing::Test
+{
+public:
+  PvxsUpdatePlanTests()
+  {
+    sup::dto::AnyValue array_of_scalars(2, sup::dto::SignedInteger32Type);
+    array_of_scalars[0] = 42;
+    array_of_scalars[1] = 43;
+    const sup::dto::AnyValue internal_struct = {
+        {{"name", {sup::dto::StringType, "internal"}},
+         {"weight", {sup::dto::Float64Type, 1.5}},
+         {"array", array_of_scalars}},
+        "internal_struct"};
+    m_struct_value = {{{"counter", {sup::dto::UnsignedInteger32Type, 1}},
+                       {"internal", internal_struct},
+                       {"flag", {sup::dto::BooleanType, false}}},
+                      "external_struct"};
+  }
+
+  sup::dto::AnyValue m_struct_value;
+};
+
+//! Applying the plan after changing a single field only assigns and marks that field. The PVXS
+//! value then converts back to the changed AnyValue.
+TEST_F(PvxsUpdatePlanTests, ApplyMarksChangedFields)
+{
+  auto any_value = m_struct_value;
+  auto pvxs_value = BuildPVXSValue(any_value);
+
+  PvxsUpdatePlan plan;
+  EXPECT_FALSE(plan.IsCompiled());
+  EXPECT_FALSE(plan.Apply());
+  EXPECT_TRUE(plan.Compile(pvxs_value, any_value));
+  EXPECT_TRUE(plan.IsCompiled());
+
+  // nothing changed
+  EXPECT_TRUE(plan.Apply());
+  EXPECT_FALSE(pvxs_value.isMarked(true, true));
+
+  any_value["internal.weight"] = 2.5;
+  EXPECT_TRUE(plan.Apply());
+  EXPECT_TRUE(pvxs_value["internal.weight"].isMarked());
+  EXPECT_FALSE(pvxs_value["counter"].isMarked());
+  EXPECT_FALSE(pvxs_value["internal.name"].isMarked());
+  EXPECT_FALSE(pvxs_value["internal.array"].isMarked());
+  EXPECT_EQ(BuildAnyValue(pvxs_value), any_value);
+
+  any_value["internal.array"][1] = 44;
+  EXPECT_TRUE(plan.Apply());
+  EXPECT_TRUE(pvxs_value["internal.array"].isMarked());
+  EXPECT_FALSE(pvxs_value["internal.weight"].isMarked());
+  EXPECT_EQ(BuildAnyValue(pvxs_value), any_value);
+
+  plan.Reset();
+  EXPECT_FALSE(plan.IsCompiled());
+  EXPECT_FALSE(plan.Apply());
+}
+
+//! The plan can not be compiled for an AnyValue with a different layout.
+TEST_F(PvxsUpdatePlanTests, CompileWithDifferentLayout)
+{
+  auto pvxs_value = BuildPVXSValue(m_struct_value);
+  const sup::dto::AnyValue other_value = {{{"counter", {sup::dto::UnsignedInteger32Type, 1}}},
+                                          "external_struct"};
+
+  PvxsUpdatePlan plan;
+  EXPECT_FALSE(plan.IsUnsupported());
+  EXPECT_FALSE(plan.Compile(pvxs_value, other_value));
+  EXPECT_FALSE(plan.IsCompiled());
+  EXPECT_TRUE(plan.IsUnsupported());
+  plan.Reset();
+  EXPECT_FALSE(plan.IsUnsupported());
+  EXPECT_TRUE(plan.Compile(pvxs_value, m_struct_value));
+  EXPECT_FALSE(plan.IsUnsupported());
+
+  // char8 members are published as uint8 fields
+  const sup::dto::AnyValue char_value = {{{"character", {sup::dto::Character8Type, 'a'}}},
+                                         "char_struct"};
+  auto pvxs_char_value = BuildPVXSValue(char_value);
+  EXPECT_FALSE(plan.Compile(pvxs_char_value, char_value));
+}